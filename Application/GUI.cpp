@@ -6,327 +6,288 @@
 #include "GUI.hpp"
 #include "DS3231.hpp"
 
+namespace {
+	const char * const settingsItems[] = {"Vol: ", "Bass: ", "Mute: ", "RDS:  ", "Back"};
 
-/// \brief
-/// Constructor
-/// \details
-/// This constructor has no mandatory parameters. The location defaults to hwlib::xy(0, 0), height to 5 and width
-/// also to 5. However, these can be given to make use of the object.
-batteryBars::batteryBars(const hwlib::xy & position, const unsigned int height, const unsigned int width):
-	left(position, hwlib::xy(position.x, position.y + height)),
-	right(hwlib::xy(position.x + width, position.y), hwlib::xy(position.x + width, position.y + height + 1)),
-	top(hwlib::xy(position.x, position.y + height), hwlib::xy(position.x + width, position.y + height)),
-	bottom(position, hwlib::xy(position.x + width, position.y)),
-	tip(hwlib::xy(position.x - 1, position.y + 1), hwlib::xy(position.x -1, position.y + height - 1)),
-	height(height),
-	width(width),
-	position(position)
-{}
-
-
-/// \brief
-/// Print Bars
-/// \details
-/// This function prints the amount of bars relative to the given percentage of voltage.
-void batteryBars::print(hwlib::window & window, const unsigned int percentage){
-	left.draw(window);
-	right.draw(window);
-	top.draw(window);
-	bottom.draw(window);
-	tip.draw(window);
-	for(unsigned int i = 0; i <= (width * 10) / 10 * percentage / 100; i++){
-		hwlib::line line(hwlib::xy( position.x + width - i, position.y), hwlib::xy(  position.x + width - i, position.y + height ));
-	   	line.draw(window);
-	}
-	window.flush();
-}
-
-//<<<--------------------------------------------------------------------------->>>
-
-/// \brief
-/// Constructor
-/// \details
-/// This constructor has no mandatory parameters. The location defaults to hwlib::xy(0, 0), height to 5 and width
-/// to 15. However, these can be given to make use of the object.
-signalBars::signalBars(const hwlib::xy & position, const unsigned int spacing, const unsigned int heightIncrement):
-	spacing(spacing),
-	heightIncrement(heightIncrement),
-	first(position, hwlib::xy(position.x, position.y - heightIncrement)),
-	second(hwlib::xy(position.x + spacing * 1, position.y), hwlib::xy(position.x + spacing * 1, position.y - heightIncrement * 2)),
-	third(hwlib::xy(position.x + spacing * 2, position.y), hwlib::xy(position.x + spacing * 2, position.y - heightIncrement * 3)),
-	fourth(hwlib::xy(position.x + spacing * 3, position.y), hwlib::xy(position.x + spacing * 3, position.y - heightIncrement * 4)),
-	fifth(hwlib::xy(position.x + spacing * 4, position.y), hwlib::xy(position.x + spacing * 4, position.y - heightIncrement * 5))
-{}
-
-/// \brief
-/// Print Bars
-/// \details
-/// This constructor function prints the given amount of lines; from 0 to 5.
-void signalBars::print(hwlib::window & window, const unsigned int amountOfLines){
-	if(amountOfLines > 0){
-		first.draw(window);
-	}
-	if(amountOfLines > 1){
-		second.draw(window);
-	}
-	if(amountOfLines > 2){
-		third.draw(window);
-	}
-	if(amountOfLines > 3){
-		fourth.draw(window);
-	}
-	if(amountOfLines > 4){
-		fifth.draw(window);
+	bool hasText(const char * text){
+		for(unsigned int i = 0; i < 64 && text[i] != '\0'; i++){
+			if(text[i] != ' '){
+				return true;
+			}
+		}
+		return false;
 	}
-	window.flush();
 }
 
 
-
-//<<<------------------------------------------------------------------------------>>>
-
-
 /// \brief
 /// Constructor
 /// \details
-/// This constructor has a lot of mandatory parameters. However, they all seem very logical when you look at
-/// the first part of the main.cpp from this application.
-GUI::GUI(hwlib::window & window, hwlib::glcd_oled & display, KY040 & button, 
-	hwlib::terminal_from & stereoField, 
-	hwlib::window & signalWindow, 
-	hwlib::window & batteryWindow,
-	hwlib::terminal_from & frequencyField,
-	hwlib::terminal_from & menuField,
-	hwlib::terminal_from & settingsField,
-	hwlib::terminal_from & stationField
-):
-	window(window),
-	display(display), 
-	button(button),
-	signalIndicator(signalBars(hwlib::xy(110, 8), 2, 2)),
-	batteryIndicator(batteryBars(hwlib::xy(90, 2))),
-	stereoField(stereoField),
-	signalWindow(signalWindow),
-	batteryWindow(batteryWindow),
-	frequencyField(frequencyField),
-	menuField(menuField),
-	settingsField(settingsField),
-	stationField(stationField)
+/// This constructor has one mandatory parameter; the display. It can be any 128x64 hwlib::window; the SSD1306 on
+/// the radio, or the offscreen framebuffer of the benchmark on the host. The positions and fonts of all widgets
+/// are fixed at compile time by the layout (see layout.hpp); the fonts are shared.
+GUI::GUI(hwlib::window & display):
+	display(display),
+	root(display),
+	signalIndicator(display, hwlib::xy(2, 8)),
+	batteryLevel(display, hwlib::xy(1, 2)),
+	stereoLabel(display, "MN"),
+	frequencyField(display, 1),
+	menuLabel(display),
+	stationTicker(display),
+	settingsList(display, settingsItems, 5),
+	spectrumRoot(display),
+	spectrum(display),
+	spectrumLabel(display)
 {
 	display.clear();
+	root.add(signalIndicator);
+	root.add(batteryLevel);
+	root.add(stereoLabel);
+	root.add(frequencyField);
+	root.add(menuLabel);
+	root.add(stationTicker);
+	spectrumRoot.add(spectrum);
+	spectrumRoot.add(spectrumLabel);
 }
 
-/*					TEA5767 Compatible
-void GUI::receptionStrength(const unsigned int signalStrength){
-	display.clear();
-	signalIndicator.print(window, signalStrength / 45);
-}
-*/
-
 /// \brief
 /// Print Reception Strenght
 /// \details
-/// This function calls print() from signalBars.
-				   //RDA5807 Compatible
+/// This function shows the signal strength (RDA5807 scale) as 0 to 5 bars.
 void GUI::receptionStrength(const unsigned int signalStrength){
-	signalWindow.clear();
-	signalIndicator.print(window, signalStrength / 12);
+	signalIndicator.set(signalStrength / 12);
 }
 
 /// \brief
 /// Print Battery Percentage
 /// \details
-/// This function calls print() from batteryBars.
+/// This function shows the battery voltage (in tenths of volts) as percentage; 4.2V = 100%, 3.2V = 0%.
 void GUI::batteryPercentage(const unsigned int voltage){
-	batteryWindow.clear();
-	batteryIndicator.print(window, (voltage - 32) * 10);			//4.2V = 100%, 3.2V = 0%
+	batteryLevel.set((voltage > 32) ? (voltage - 32) * 10 : 0);
 }
 
 /// \brief
 /// Display Stereo
 /// \details
-/// This function prints "ST" or "MN" when respectively stereo or mono signal is received
-/// . It prints this in the given StereoField.
+/// This function shows "ST" or "MN" when respectively stereo or mono signal is received.
 void GUI::displayStereo(const bool stereo){
-	if(stereo){
-		stereoField << "\f" << "ST" << hwlib::flush;
-	} else {
-		stereoField << "\f" << "MN" << hwlib::flush;
-	}
+	stereoLabel.set(stereo ? "ST" : "MN");
 }
 
 /// \brief
 /// Display Station Name
 /// \details
-/// This function prints the given station name in the textArea field and then also prints
+/// This function shows the given station name in the station field and then also shows
 /// the signalindicator since this could have changed after retrieving RDS station Name.
 void GUI::displayStationName(const char & stationName){
-	auto font = hwlib::font_default_8x8();
-	auto textArea = hwlib::terminal_from(window, font);
-	textArea << hwlib::right << stationName << hwlib::flush;
-	signalIndicator.print(window, 60 / 12);
+	stationTicker.set(&stationName);
+	signalIndicator.set(60 / 12);
+	root.render();
 }
 
 /// \brief
 /// Display Menu
 /// \details
-/// This function prints the current menu the user is in; can be one of
-/// auto, manual or presets.
-void GUI::displayMenuArea(const unsigned int menuArea){
+/// This function shows the current menu the user is in, or the setting that belongs to it. The settings
+/// of the radio are only read when their Menu Area is selected. Area 7 shows the date, or the wake-up time while it
+/// is being changed; see showWakeUp().
+void GUI::displayMenuArea(const unsigned int menuArea, Radio & radio, const bool showRadioDataStationName, const bool curMute, const dateData & date){
 	if(menuArea == 0){
-		menuField << "\f" << "      Auto " << hwlib::flush;
+		menuLabel.set("      Auto ");
 	} else if (menuArea == 1){
-		menuField << "\f" << "     Manual" << hwlib::flush;
+		menuLabel.set("     Manual");
 	} else if (menuArea == 2){
-		menuField << "\f" << "     Presets" << hwlib::flush;
+		menuLabel.set("     Presets");
+	} else if (menuArea == 3){
+		menuLabel.set(radio.bassBoosted() ? " Bass Boosted" : " Bass Unboosted");
+	} else if (menuArea == 4){
+		menuLabel.set(curMute ? "   Bluetooth" : "     Radio");
+	} else if (menuArea == 5){
+		menuLabel.set(radio.radioDataEnabled() ? "  RDS enabled" : "  RDS disabled");
+	} else if (menuArea == 6){
+		menuLabel.set(showRadioDataStationName ? "    RDS Name" : "   Preset Name");
+	} else if (menuArea == 8){
+		menuLabel.set("   Band Scan");
+	} else if (wakeUpShown && !wakeUpEnabled){
+		menuLabel.set("  Wake-Up Off");
+	} else if (wakeUpShown){
+		char text[] = "  Wake-Up 00:00";
+		text[10] += wakeUpHours / 10;
+		text[11] += wakeUpHours % 10;
+		text[13] += wakeUpMinutes / 10;
+		text[14] += wakeUpMinutes % 10;
+		menuLabel.set(text);
+	} else {
+		char text[17];
+		auto stream = textStream(text, sizeof(text));
+		stream << "    " << date;
+		menuLabel.set(text);
 	}
 }
 
+/// \brief
+/// Show Wake-Up
+/// \details
+/// This function makes Area 7 show the given wake-up time (or that the wake-up is disabled) instead of the date, until
+/// it is called with show set to false. It is drawn with the next update.
+void GUI::showWakeUp(const bool show, const unsigned int hours, const unsigned int minutes, const bool enabled){
+	wakeUpShown = show;
+	wakeUpHours = hours;
+	wakeUpMinutes = minutes;
+	wakeUpEnabled = enabled;
+}
+
 /// \brief
 /// Display Tuned Frequency
 /// \details
-/// This function prints the currently tuned frequency in the frequencyField.
+/// This function shows the currently tuned frequency (in tenths of MHz); surrounded by '<' and '>' when it can be changed.
 void GUI::displayFrequency(const unsigned int frequency, const bool change){
-	if(change){
-		frequencyField << "\f" << '<' << frequency / 10 << '.' << (frequency % 10) << '>' << hwlib::flush;
-	} else {
-		frequencyField << "\f" << ' ' << frequency / 10 << '.' << (frequency % 10) << ' ' << hwlib::flush;
-	}
+	frequencyField.set(frequency);
+	frequencyField.highlight(change);
 }
 
 /// \brief
 /// Update GUI
 /// \details
-/// This function updates all values that have changed.
+/// This function hands all values to their widgets and renders the ones that have changed; the others aren't drawn at
+/// all. Combined with the change tracking of the SSD1306, only the columns that actually changed are sent to the display.
+/// When force is true, everything is drawn.
 void GUI::displayMenuUpdate(const unsigned int signalStrength, const float frequency, const bool change, const unsigned int voltage,const bool stereo, const unsigned int menuArea, Radio & radio, const bool showRadioDataStationName, const char*  stationName, const bool curMute, const dateData & date, const bool force){
-	if(frequency != lastFrequency || change != lastChange || force){
-		displayFrequency(frequency, change);
-		displayMenuArea(menuArea);
-		displayStereo(stereo);
-		lastStereo = stereo;
-		lastFrequency = frequency;
-		lastChange = change;
-	}
-	if(signalStrength / 12 != lastSignalStrength || force){
-		receptionStrength(signalStrength);
-		lastSignalStrength = signalStrength / 12;
-	}
-	if(voltage != lastVoltage || force){
-		batteryPercentage(voltage);
-		lastVoltage = voltage;
-	}
-	if(stereo != lastStereo || force){
-		displayStereo(stereo);
-		lastStereo = stereo;
+	if(spectrumShown){
+		return;
 	}
-	if(menuArea != lastMenuArea && menuArea < 3){
-		displayMenuArea(menuArea);
-		lastMenuArea = menuArea;
+	displayFrequency(frequency, change);
+	receptionStrength(signalStrength);
+	batteryPercentage(voltage);
+	displayStereo(stereo);
+	displayMenuArea(menuArea, radio, showRadioDataStationName, curMute, date);
+	const bool radioTextShown = showRadioText;
+	showRadioText = showRadioDataStationName && radioText != nullptr && hasText(radioText);
+	if(showRadioText != radioTextShown){
+		stationTicker.restart();		//Switched between the station name and the RadioText
 	}
-	if((menuArea == 3 && menuArea != lastMenuArea) || radio.bassBoosted() != lastBoost){
-		menuField << hwlib::boolalpha;
-		menuField << "\f" << " Bass ";
-		if(radio.bassBoosted()){
-			menuField << "Boosted";
-		} else {
-			menuField << "Unboosted";
-		}
-		menuField << hwlib::flush;
-		lastBoost = radio.bassBoosted();
-		lastMenuArea = menuArea;
+	stationTicker.set(showRadioText ? radioText : stationName);
+	if(force){
+		root.invalidate();
 	}
-	if((menuArea == 4 && menuArea != lastMenuArea) || curMute != lastMute){
-		menuField << hwlib::boolalpha;
-		if(curMute){
-			menuField << "\f" << "   Bluetooth";
-		} else {
-			menuField << "\f" << "     Radio";
-		}
-		menuField << hwlib::flush;
-		lastMute = curMute;
-		lastMenuArea = menuArea;
+	root.render();
+}
+
+/// \brief
+/// Set Radio Text
+/// \details
+/// This function sets the buffer the RadioText is received in; radio.radioData.stationText() for example. It isn't
+/// copied, so it has to exist as long as the GUI does. When showing Radio Data is allowed and a RadioText has been
+/// received, it is shown in the station field instead of the station name.
+void GUI::setRadioText(const char * text){
+	radioText = text;
+}
+
+/// \brief
+/// Scroll Station Text
+/// \details
+/// This function moves the text in the station field one step when it is too long to fit; new characters of the
+/// RadioText are taken along. Only the changed columns are drawn. Call it at a fixed rate (20 times per second for
+/// example); it returns true if something has been drawn.
+bool GUI::scrollStationText(){
+	if(spectrumShown){
+		return false;
 	}
-	if((menuArea == 5 && menuArea != lastMenuArea) || radio.radioDataEnabled() != lastEnabled){
-		menuField << hwlib::boolalpha;
-		if(radio.radioDataEnabled()){
-			menuField << "\f" << "  RDS enabled";
-		} else {
-			menuField << "\f" << "  RDS disabled";
-		}
-		menuField << hwlib::flush;
-		lastEnabled = radio.radioDataEnabled();
-		lastMenuArea = menuArea;
+	if(showRadioText){
+		stationTicker.set(radioText);
 	}
-	if((menuArea == 6) || showRadioDataStationName != lastStationRDS){
-		menuField << hwlib::boolalpha;
-		if(showRadioDataStationName){
-			menuField << "\f" << " 	  RDS Name";
-		} else {
-			menuField << "\f" << "   Preset Name";
-		}
-		menuField << hwlib::flush;
-		lastStationRDS = showRadioDataStationName;
-		lastMenuArea = menuArea;
+	stationTicker.scroll();
+	return root.render();
+}
+
+/// \brief
+/// Restart Station Text
+/// \details
+/// This function shows the text in the station field from its start again. Call it when a new RadioText has started;
+/// see radioDataSystem::getTextChanges().
+void GUI::restartStationText(){
+	stationTicker.restart();
+}
+
+/// \brief
+/// Show Spectrum
+/// \details
+/// This function switches between the spectrum of a band scan (true) and the normal GUI (false). When switched, the
+/// display is cleared and the other screen is drawn completely with its next render. While the spectrum is shown,
+/// displayMenuUpdate() and scrollStationText() draw nothing.
+void GUI::showSpectrum(const bool show){
+	if(show == spectrumShown){
+		return;
 	}
-	if(menuArea == 7){
-		menuField << "\f" << "    " << date << hwlib::flush;
-		lastMenuArea = menuArea;
+	spectrumShown = show;
+	display.clear();
+	if(show){
+		spectrumRoot.invalidate();
+	} else {
+		root.invalidate();
 	}
-	displayStereo(stereo);
-	lastStereo = stereo;
-	stationField << "\f" << stationName << hwlib::flush;
-	for(unsigned int i = 0; i < 9; i++){
-		lastStationName[i] = stationName[i];
+}
+
+/// \brief
+/// Display Spectrum Column
+/// \details
+/// This function sets the height of one column of the spectrum to the given signal strength (RDA5807 scale; 0 to 127).
+void GUI::displaySpectrumColumn(const unsigned int column, const unsigned int signalStrength){
+	spectrum.set(column, signalStrength * layout::spectrum::height / 128);
+}
+
+/// \brief
+/// Display Spectrum Cursor
+/// \details
+/// This function moves the cursor of the spectrum to the given column and shows the given frequency (in tenths of MHz).
+void GUI::displaySpectrumCursor(const unsigned int column, const unsigned int frequency){
+	spectrum.setCursor(column);
+	char text[17];
+	auto stream = textStream(text, sizeof(text));
+	stream << "   " << frequency / 10 << "." << frequency % 10 << " MHz";
+	spectrumLabel.set(text);
+}
+
+/// \brief
+/// Render Spectrum
+/// \details
+/// This function draws the columns of the spectrum that have changed, and the frequency when it changed. It returns true
+/// if something has been drawn; the display is then flushed once.
+bool GUI::renderSpectrum(){
+	if(!spectrumShown){
+		return false;
 	}
+	return spectrumRoot.render();
 }
 
 /// \brief
 /// Display Settings
 /// \details
-/// This function prints all given settings. Is interchangable between RDA5807 and TEA5767 since they have
-/// the same base class. Currently not used.
+/// This function shows all settings in a list of which the item at the position of the encoder is selected. Is
+/// interchangable between RDA5807 and TEA5767 since they have the same base class. Currently not used.
 void GUI::showSettings(KY040 & button, Radio & radio, unsigned int & menuArea){
 	button.update();
 	auto pos = button.getPos();
-	hwlib::cout << hwlib::boolalpha;
-	if(pos == 0){
-		settingsField << 	"\f" << "-> Vol: " << radio.getVolume() <<
-					"\n" << "   Bass: " << radio.bassBoosted() <<
-				"\t0002" << "   Mute: " << radio.isMuted() <<
-				"\t0003" << "   RDS:  " << radio.radioDataEnabled() <<
-				"\t0004" << "   Back" <<
-				hwlib::flush;
-	} else if (pos == 1){
-		settingsField << 	"\f" << "   Vol: " << radio.getVolume() <<
-					"\n" << "-> Bass: " << radio.bassBoosted() <<
-				"\t0002" << "   Mute: " << radio.isMuted() <<
-				"\t0003" << "   RDS:  " << radio.radioDataEnabled() <<
-				"\t0004" << "   Back" <<
-				hwlib::flush;
-	} else if (pos == 2){
-		settingsField << 	"\f" << "   Vol: " << radio.getVolume() <<
-					"\n" << "   Bass: " << radio.bassBoosted() <<
-				"\t0002" << "-> Mute: " << radio.isMuted() <<
-				"\t0003" << "   RDS:  " << radio.radioDataEnabled() <<
-				"\t0004" << "   Back" <<
-				hwlib::flush;
-	} else if (pos == 3){
-		settingsField << 	"\f" << "   Vol: " << radio.getVolume() <<
-					"\n" << "   Bass: " << radio.bassBoosted() <<
-				"\t0002" << "   Mute: " << radio.isMuted() <<
-				"\t0003" << "-> RDS:  " << radio.radioDataEnabled() <<
-				"\t0004" << "   Back" <<
-				hwlib::flush;
-	} else {
-		settingsField << 	"\f" << "   Vol: " << radio.getVolume() <<
-					"\n" << "   Bass: " << radio.bassBoosted() <<
-				"\t0002" << "   Mute: " << radio.isMuted() <<
-				"\t0003" << "   RDS:  " << radio.radioDataEnabled() <<
-				"\t0004" << "-> Back" <<
-				hwlib::flush;
+	settingsList.select((pos >= 0 && unsigned(pos) < settingsList.getAmountOfItems()) ? pos : settingsList.getAmountOfItems() - 1);
+	settingsList.setValue(0, radio.getVolume());
+	settingsList.setValue(1, radio.bassBoosted());
+	settingsList.setValue(2, radio.isMuted());
+	settingsList.setValue(3, radio.radioDataEnabled());
+	if(settingsList.render()){
+		display.flush();
 	}
 	if(button.isPressed()){
 		menuArea = 0;
 		button.setPos(0);
+		root.invalidate();
 	}
 }
+
+/// \brief
+/// Get Renders
+/// \details
+/// This function returns how many times the GUI has flushed the display because something changed.
+unsigned int GUI::getRenders(){
+	return root.getFlushes();
+}
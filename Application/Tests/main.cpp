@@ -0,0 +1,467 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "widgets.hpp"
+#include "refreshGovernor.hpp"
+#include "RDA5807.hpp"
+#include "A24C256.hpp"
+#include "radioDataCache.hpp"
+#include "presetStore.hpp"
+#include "crc8.hpp"
+#include "keyValueStore.hpp"
+#include "alarmClock.hpp"
+#include "menu.hpp"
+
+/// \brief
+/// Counting Window
+/// \details
+/// This is a 128x64 window that only counts how many pixels have been written and how often it has been flushed;
+/// nothing is shown. It makes the amount of rendering work visible without a display.
+class countingWindow : public hwlib::window {
+	private:
+		unsigned int writes = 0;
+		unsigned int flushes = 0;
+	protected:
+		void write_implementation(hwlib::xy, hwlib::color) override {
+			writes++;
+		}
+	public:
+		countingWindow():
+			window(hwlib::xy(128, 64), hwlib::white, hwlib::black)
+		{}
+
+		void flush() override {
+			flushes++;
+		}
+
+		unsigned int getWrites(){
+			return writes;
+		}
+
+		unsigned int getFlushes(){
+			return flushes;
+		}
+};
+
+/// \brief
+/// Simulated Bus
+/// \details
+/// This is an I2C bus on which the chips of the radio are simulated instead of addressed; an RDA5807 (sequential and
+/// indexed access), a 24C256 and the registers of a DS3231. Every chip acknowledges right away and keeps its registers
+/// or memory in RAM. The Radio Data blocks that the RDA5807 returns can be set, so decoding can be tested without
+/// receiving a station.
+class simulatedBus : public hwlib::i2c_bus_bit_banged_scl_sda {
+	private:
+		uint16_t radioRegisters[16] = {};
+		uint8_t clockRegisters[19] = {};
+		uint8_t memory[32768] = {};
+		uint8_t address = 0;
+		bool reading = false;
+		unsigned int position = 0;		//Bytes written since the start condition, including the address
+		unsigned int pointer = 0;		//Register or memory location of the next byte
+		bool lowByte = false;
+	public:
+		simulatedBus():
+			i2c_bus_bit_banged_scl_sda(hwlib::pin_oc_dummy, hwlib::pin_oc_dummy)
+		{}
+
+		void write_start() override {
+			position = 0;
+		}
+
+		void write_stop() override {}
+		void write_ack() override {}
+		void write_nack() override {}
+
+		bool read_ack() override {
+			return true;
+		}
+
+		void write_byte(uint8_t x) override {
+			if(position++ == 0){
+				address = x >> 1;
+				reading = x & 1;
+				lowByte = false;
+				if(address == 0x10){
+					pointer = reading ? 0x0A : 0x02;		//Sequential access starts at register 2 or 0x0A
+				}
+				return;
+			}
+			if(address == 0x11 && position == 2){
+				pointer = x;
+			} else if(address == 0x10 || address == 0x11){
+				radioRegisters[pointer & 0x0F] = lowByte ? ((radioRegisters[pointer & 0x0F] & 0xFF00) | x) : ((radioRegisters[pointer & 0x0F] & 0x00FF) | (x << 8));
+				pointer += lowByte;
+				lowByte = !lowByte;
+			} else if(address == 0x50 && position == 2){
+				pointer = x << 8;
+			} else if(address == 0x50 && position == 3){
+				pointer |= x;
+			} else if(address == 0x50){
+				memory[pointer & 0x7FFF] = x;
+				pointer = (pointer & ~0x3Fu) | ((pointer + 1) & 0x3F);		//Wraps within the page, just like the chip
+			} else if(address == 0x68 && position == 2){
+				pointer = x;
+			} else if(address == 0x68){
+				clockRegisters[pointer++ % 19] = x;
+			}
+		}
+
+		uint8_t read_byte() override {
+			if(address == 0x10 || address == 0x11){
+				const uint16_t value = radioRegisters[pointer & 0x0F];
+				pointer += lowByte;
+				lowByte = !lowByte;
+				return lowByte ? value >> 8 : value & 0xFF;
+			} else if(address == 0x50){
+				return memory[pointer++ & 0x7FFF];
+			} else if(address == 0x68){
+				return clockRegisters[pointer++ % 19];
+			}
+			return 0xFF;
+		}
+
+		/// \brief
+		/// Set Radio Data Group
+		/// \details
+		/// This function makes the RDA5807 return the given blocks; ready, synchronized and without errors.
+		void setGroup(const uint16_t blockA, const uint16_t blockB, const uint16_t blockC, const uint16_t blockD){
+			radioRegisters[0x0A] |= 0x9000;
+			radioRegisters[0x0B] = 0;
+			radioRegisters[0x0C] = blockA;
+			radioRegisters[0x0D] = blockB;
+			radioRegisters[0x0E] = blockC;
+			radioRegisters[0x0F] = blockD;
+		}
+
+		uint8_t & memoryAt(const unsigned int location){
+			return memory[location & 0x7FFF];
+		}
+
+		uint8_t getClockRegister(const unsigned int reg){
+			return clockRegisters[reg % 19];
+		}
+};
+
+/// \brief
+/// Same Text
+/// \details
+/// This function returns true if both texts are equal.
+bool sameText(const char * first, const char * second){
+	unsigned int i = 0;
+	for(; first[i] != '\0' && second[i] != '\0'; i++){
+		if(first[i] != second[i]){
+			return false;
+		}
+	}
+	return first[i] == second[i];
+}
+
+/// \brief
+/// Send Station Name
+/// \details
+/// This function sends the given name of 8 characters in the four segments of group 0, as version A or B, and decodes
+/// every group. The Program Identification is 0x8203.
+void sendStationName(simulatedBus & i2c_bus, RDA5807 & radio, const char * name, const bool versionA){
+	for(unsigned int segment = 0; segment < 4; segment++){
+		i2c_bus.setGroup(0x8203, (versionA ? 0x0800 : 0x0000) | segment, 0xE0CD, (name[segment * 2] << 8) | name[segment * 2 + 1]);
+		radio.radioData.update();
+	}
+}
+
+/// \brief
+/// Test
+/// \details
+/// This program tests ALL functionality of the widgets and the refresh governor, the decoding and caching of the Radio
+/// Data, the preset table, the alarm clock and the gesture recognizer. No chips are needed; the widgets are drawn on a
+/// window that only counts, the governor, alarm clock and gesture recognizer are given the time and the chips are
+/// simulated on the bus, so this test can be run natively as well. The results are deterministic.
+int main( void ){
+  hwlib::wait_ms(1000);   //Wait for terminal
+
+  auto screen = countingWindow();
+  auto font = hwlib::font_default_8x8();
+  auto topWindow = hwlib::window_part(screen, hwlib::xy(0, 0), hwlib::xy(128, 10));
+  auto bottomWindow = hwlib::window_part(screen, hwlib::xy(0, 54), hwlib::xy(128, 64));
+  auto barWindow = hwlib::window_part(screen, hwlib::xy(108, 20), hwlib::xy(128, 35));
+  auto batteryWindow = hwlib::window_part(screen, hwlib::xy(89, 20), hwlib::xy(106, 30));
+
+  auto root = widgetGroup(screen);
+  auto title = label(topWindow, font, "Radio");
+  auto value = numericField(bottomWindow, font, 1);
+  auto bars = barIndicator(barWindow, hwlib::xy(2, 8));
+  auto battery = batteryIndicator(batteryWindow, hwlib::xy(1, 2));
+  hwlib::cout << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "Widgets can be added: " << (root.add(title) && root.add(value) && root.add(bars) && root.add(battery)) << hwlib::endl;
+
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "First render draws all widgets: " << (root.render() && title.getRenders() == 1 && value.getRenders() == 1 && bars.getRenders() == 1 && battery.getRenders() == 1) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Window is flushed once per render: " << (screen.getFlushes() == 1 && root.getFlushes() == 1) << hwlib::endl;
+
+  auto writes = screen.getWrites();
+  title.set("Radio");
+  value.set(0);
+  bars.set(0);
+  battery.set(0);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Setting the same values does not change widgets: " << (!root.isChanged()) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Unchanged widgets are not drawn or flushed: " << (!root.render() && screen.getWrites() == writes && screen.getFlushes() == 1) << hwlib::endl;
+
+  value.set(1003);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Only the changed widget is drawn: " << (root.render() && value.getRenders() == 2 && title.getRenders() == 1 && bars.getRenders() == 1 && battery.getRenders() == 1) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Changed widget is flushed once: " << (screen.getFlushes() == 2) << hwlib::endl;
+
+  value.highlight();
+  bars.set(3);
+  battery.set(60);
+  root.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Multiple changes are flushed together: " << (value.getRenders() == 3 && bars.getRenders() == 2 && battery.getRenders() == 2 && screen.getFlushes() == 3) << hwlib::endl;
+
+  root.invalidate();
+  root.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Invalidate redraws all widgets: " << (title.getRenders() == 2 && value.getRenders() == 4 && bars.getRenders() == 3 && battery.getRenders() == 3) << hwlib::endl;
+
+  const char * const items[] = {"Vol: ", "Bass: ", "Back"};
+  auto list = menuList(screen, font, items, 3);
+  list.setValue(0, 5);
+  list.render();
+  list.select(0);
+  list.setValue(0, 5);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu list does not change on same selection and value: " << (!list.isChanged()) << hwlib::endl;
+  list.select(1);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu list changes on new selection: " << (list.isChanged() && list.getSelected() == 1) << hwlib::endl;
+  list.render();
+  list.setValue(0, 8);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu list changes on new value: " << (list.isChanged() && list.render() && list.getRenders() == 3) << hwlib::endl;
+  list.select(5);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu list ignores invalid selection: " << (!list.isChanged() && list.getSelected() == 1 && list.getAmountOfItems() == 3) << hwlib::endl;
+
+  auto tickerWindow = hwlib::window_part(screen, hwlib::xy(50, 54), hwlib::xy(128, 64));
+  auto ticker = marquee(tickerWindow, font);
+  ticker.set("RADIO 1");
+  ticker.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Marquee does not scroll text that fits: " << (!ticker.isScrolling() && !ticker.scroll() && !ticker.isChanged()) << hwlib::endl;
+  ticker.set("This RadioText is a lot longer than the window");
+  ticker.invalidate();
+  writes = screen.getWrites();
+  ticker.render();
+  auto fullWrites = screen.getWrites() - writes;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Marquee scrolls text that doesn't fit: " << (ticker.isScrolling() && ticker.scroll() && ticker.isChanged()) << hwlib::endl;
+  writes = screen.getWrites();
+  ticker.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Marquee only writes the columns that changed: " << (screen.getWrites() - writes < fullWrites && screen.getWrites() - writes > 0) << hwlib::endl;
+  ticker.set("This RadioText is a lot longer than the window, and grows");
+  ticker.render();
+  ticker.restart();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Marquee keeps its position when the text grows: " << ticker.isChanged() << hwlib::endl;
+  ticker.render();
+  writes = screen.getWrites();
+  ticker.set("This RadioText is a lot longer than the window, and grows");
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Marquee does not change on same text: " << (!ticker.render() && screen.getWrites() == writes) << hwlib::endl;
+
+  auto spectrumWindow = hwlib::window_part(screen, hwlib::xy(0, 0), hwlib::xy(128, 54));
+  auto spectrum = spectrumGraph(spectrumWindow);
+  spectrum.render();
+  writes = screen.getWrites();
+  spectrum.set(10, 20);
+  spectrum.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Spectrum only draws the changed column: " << (screen.getWrites() - writes == 54) << hwlib::endl;
+  writes = screen.getWrites();
+  spectrum.set(10, 20);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Spectrum does not change on same height: " << (!spectrum.render() && screen.getWrites() == writes) << hwlib::endl;
+  spectrum.setCursor(10);
+  spectrum.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Spectrum cursor draws the old and new column: " << (screen.getWrites() - writes == 2 * 54 && spectrum.getCursor() == 10) << hwlib::endl;
+  writes = screen.getWrites();
+  spectrum.invalidate();
+  spectrum.render();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Invalidated spectrum draws all columns: " << (screen.getWrites() - writes == 128 * 54) << hwlib::endl;
+
+  auto governor = refreshGovernor(10, 1);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor draws no frame when nothing changed: " << (!governor.poll(0)) << hwlib::endl;
+  governor.request(refreshReason::menu, 0);
+  governor.request(refreshReason::clock, 0);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor coalesces changes into one frame: " << (governor.poll(0) && !governor.poll(1) && governor.includes(refreshReason::menu) && governor.includes(refreshReason::clock) && governor.getCoalesced() == 1) << hwlib::endl;
+  governor.request(refreshReason::frequency, 1);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor limits the frame rate: " << (!governor.poll(50) && governor.poll(100) && !governor.includes(refreshReason::clock)) << hwlib::endl;
+  governor.request(refreshReason::clock, 100);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor gives background changes a lower frame rate: " << (!governor.poll(200) && !governor.poll(1099) && governor.poll(1100)) << hwlib::endl;
+  governor.request(refreshReason::battery, 1150);
+  governor.request(refreshReason::frequency, 1150);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor gives foreground changes priority: " << (governor.poll(1200) && governor.includes(refreshReason::battery)) << hwlib::endl;
+  governor.setBusy();
+  governor.request(refreshReason::frequency, 1300);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor draws no frames while busy: " << (!governor.poll(1300) && !governor.poll(2000) && governor.isPending()) << hwlib::endl;
+  governor.setBusy(false);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor draws pending frame when done: " << (governor.poll(2010) && !governor.isPending() && governor.getFrames() == 5) << hwlib::endl;
+  governor.setBusy();
+  governor.request(refreshReason::menu, 2200);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor stops waiting on a seek that takes too long: " << (!governor.poll(2200) && governor.poll(4200)) << hwlib::endl;
+  auto latencyGovernor = refreshGovernor(10, 1);
+  latencyGovernor.request(refreshReason::menu, 100);
+  latencyGovernor.request(refreshReason::clock, 110);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Governor counts the latency from the first request: " << (latencyGovernor.poll(120) && latencyGovernor.getMaxLatency() == 20) << hwlib::endl;
+
+  static simulatedBus i2c_bus;      //Its memory is too large for the stack
+  auto radio = RDA5807(i2c_bus);
+  sendStationName(i2c_bus, radio, "RADIO 2 ", true);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Station name is not shown after receiving it once: " << sameText(radio.radioData.stationName(), "        ") << hwlib::endl;
+  sendStationName(i2c_bus, radio, "RADIO 2 ", false);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Station name is shown after receiving it the same twice: " << sameText(radio.radioData.stationName(), "RADIO 2 ") << hwlib::endl;
+  sendStationName(i2c_bus, radio, "RADJO 2 ", false);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Station name received differently once is not shown: " << sameText(radio.radioData.stationName(), "RADIO 2 ") << hwlib::endl;
+  sendStationName(i2c_bus, radio, "NPO R1  ", false);
+  sendStationName(i2c_bus, radio, "NPO R1  ", true);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "New station name is shown after receiving it the same twice: " << sameText(radio.radioData.stationName(), "NPO R1  ") << hwlib::endl;
+  const auto textChanges = radio.radioData.getTextChanges();
+  i2c_bus.setGroup(0x8203, 0x1810, 0x0000, 0x0000);
+  radio.radioData.update();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Group 1A does not start a new RadioText: " << (radio.radioData.getTextChanges() == textChanges) << hwlib::endl;
+  radio.radioData.reset();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Station name is cleared by a reset: " << sameText(radio.radioData.stationName(), "        ") << hwlib::endl;
+
+  auto memory = A24C256(i2c_bus);
+  auto stations = radioDataCache(memory, 8192, 4, 2);
+  stations.format();
+  sendStationName(i2c_bus, radio, "RADIO 2 ", false);
+  sendStationName(i2c_bus, radio, "RADIO 2 ", false);
+  stationInfo decoded;
+  decoded.frequency = 92600;
+  decoded.programIdentification = radio.radioData.getProgramIdentification();
+  decoded.setName(radio.radioData.stationName());
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Cache waits for the decoded Radio Data to be stable: " << (!stations.observe(decoded) && stations.getAmount() == 0) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Cache stores the decoded station name: " << (stations.observe(decoded) && stations.getAmount() == 1) << hwlib::endl;
+  stationInfo cached;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Cached station name is found after a reload: " << (stations.load() == 1 && stations.find(92600, cached, 0x8203) && sameText(cached.name, "RADIO 2 ")) << hwlib::endl;
+
+  auto presets = presetStore(memory);
+  presets.format();
+  presets.add(preset(92.6, "RADIO 2"));
+  presets.add(preset(100.7, "Q-Music", 0x8203, 8));
+  presets.add(preset(104.4, "SKYRADIO"));
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table is loaded: " << (presets.load() && presets.getAmount() == 3 && presets.get(1).frequency == 100700 && presets.get(1).programIdentification == 0x8203 && presets.get(1).volume == 8 && sameText(presets.get(2).name, "SKYRADIO")) << hwlib::endl;
+  i2c_bus.memoryAt(presetStore::headerSize + presetStore::recordSize + 5) ^= 0x01;      //A bit error in the name of the second preset
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Corrupted preset is left out: " << (presets.load() && presets.getAmount() == 2 && presets.getCorrupted() == 1 && sameText(presets.get(1).name, "SKYRADIO")) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table is written again without it: " << (presets.load() && presets.getAmount() == 2 && presets.getCorrupted() == 0) << hwlib::endl;
+  auto changeHeader = [&](const unsigned int location, const uint8_t value){
+    uint8_t header[presetStore::headerSize];
+    for(unsigned int i = 0; i < presetStore::headerSize; i++){
+      header[i] = i2c_bus.memoryAt(i);
+    }
+    header[location] = value;
+    header[presetStore::headerSize - 1] = crc8(header, presetStore::headerSize - 1);
+    for(unsigned int i = 0; i < presetStore::headerSize; i++){
+      i2c_bus.memoryAt(i) = header[i];
+    }
+  };
+  changeHeader(2, presetStore::version + 1);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table of another version is not loaded: " << (!presets.load() && presets.getAmount() == 0) << hwlib::endl;
+  changeHeader(2, presetStore::version);
+  changeHeader(5, presetStore::maxPresets - 1);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table of another capacity is not loaded: " << (!presets.load() && presets.getAmount() == 0) << hwlib::endl;
+  changeHeader(5, presetStore::maxPresets);
+  i2c_bus.memoryAt(presetStore::headerSize - 1) ^= 0x01;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table with a wrong header CRC is not loaded: " << (!presets.load() && presets.getAmount() == 0) << hwlib::endl;
+  i2c_bus.memoryAt(presetStore::headerSize - 1) ^= 0x01;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Preset table with a restored header is loaded: " << (presets.load() && presets.getAmount() == 2) << hwlib::endl;
+
+  auto clock = DS3231(i2c_bus);
+  auto settings = keyValueStore(memory, 4096, 1024);
+  settings.mount();
+  auto radioAlarm = alarmClock(radio, presets, clock, settings, 2, 100, 3000);
+  wakeUpSettings wakeUp;
+  wakeUp.enabled = true;
+  wakeUp.hours = 6;
+  wakeUp.minutes = 45;
+  wakeUp.preset = 1;
+  wakeUp.volume = 3;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Wake-up is set to the first alarm and saved: " << (radioAlarm.setWakeUp(wakeUp) && (i2c_bus.getClockRegister(0x0E) & 0x01) && i2c_bus.getClockRegister(0x08) == 0x45 && i2c_bus.getClockRegister(0x09) == 0x06) << hwlib::endl;
+  radio.setVolume(8);
+  radio.standBy(true);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Wake-up leaves standBy at volume 1: " << (radioAlarm.handle(0x01, 0) && radioAlarm.getState() == alarmState::wakingUp && !radio.isStandBy() && radio.getVolume() == 1) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Wake-up ramps the volume up one step per interval: " << (radioAlarm.step(50) && radio.getVolume() == 1 && radioAlarm.step(100) && radio.getVolume() == 2) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Wake-up ends at the set volume: " << (!radioAlarm.step(200) && radio.getVolume() == 3 && radioAlarm.getState() == alarmState::playing && !radioAlarm.isBusy()) << hwlib::endl;
+  radioAlarm.startSleepTimer(timeData(23, 50, 0), 30);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Sleep timer sets the second alarm past midnight: " << (radioAlarm.sleepTimerRunning() && (i2c_bus.getClockRegister(0x0E) & 0x02) && i2c_bus.getClockRegister(0x0B) == 0x20 && i2c_bus.getClockRegister(0x0C) == 0x00) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Sleep timer starts fading out and disables its alarm: " << (radioAlarm.handle(0x02, 1000) && radioAlarm.getState() == alarmState::fadingOut && !radioAlarm.sleepTimerRunning() && (i2c_bus.getClockRegister(0x0E) & 0x03) == 0x01) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Fading out lowers the volume one step per interval: " << (radioAlarm.step(1100) && radio.getVolume() == 2 && radioAlarm.step(1200) && radio.getVolume() == 1) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Radio is asleep in standBy after fading out: " << (!radioAlarm.step(1300) && radioAlarm.isAsleep() && radio.isStandBy()) << hwlib::endl;
+  radioAlarm.wake();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Woken radio plays at the volume before fading out: " << (!radio.isStandBy() && radio.getVolume() == 3 && radioAlarm.getState() == alarmState::playing) << hwlib::endl;
+  radioAlarm.moveWakeUp(-50, 2000);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Moved wake-up is set right away, but not saved yet: " << (i2c_bus.getClockRegister(0x08) == 0x55 && i2c_bus.getClockRegister(0x09) == 0x05 && radioAlarm.isSavePending() && !radioAlarm.poll(4000)) << hwlib::endl;
+  radioAlarm.moveWakeUp(-6 * 60, 4000);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Wake-up is moved within a day: " << (radioAlarm.getWakeUp().hours == 23 && radioAlarm.getWakeUp().minutes == 55) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Moved wake-up is saved once it hasn't been moved for a while: " << (!radioAlarm.poll(6999) && radioAlarm.poll(7000) && !radioAlarm.isSavePending()) << hwlib::endl;
+  auto reloadedAlarm = alarmClock(radio, presets, clock, settings);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Saved wake-up is loaded: " << (reloadedAlarm.load() && reloadedAlarm.getWakeUp().enabled && reloadedAlarm.getWakeUp().hours == 23 && reloadedAlarm.getWakeUp().minutes == 55 && reloadedAlarm.getWakeUp().preset == 1) << hwlib::endl;
+
+  auto scanner = bandScanner(radio);
+  auto navigation = menu(radio, presets, scanner);
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::pressTurnClockwise, 2});
+  navigation.handle(gestureEvent{gestureType::pressTurnCounterClockwise, 1});
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Turning while pressing in Area 7 moves the wake-up: " << (navigation.getArea() == 7 && navigation.getWakeUpChange() == 5 && navigation.getWakeUpChange() == 0 && radio.getVolume() == 3) << hwlib::endl;
+  navigation.handle(gestureEvent{gestureType::longPress, 1});
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Long-pressing in Area 7 requests the wake-up: " << (navigation.wakeUpRequested() && !navigation.presetRequested()) << hwlib::endl;
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  const bool doubleClickInArea6 = navigation.usesDoubleClick();
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu doesn't use double-clicks in Area 4: " << (doubleClickInArea6 && navigation.getArea() == 4 && !navigation.usesDoubleClick()) << hwlib::endl;
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::click, 1});
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu doesn't use double-clicks in an entered area: " << (navigation.getArea() == 2 && navigation.isInPressedArea() && !navigation.usesDoubleClick()) << hwlib::endl;
+
+  auto inputEvents = inputQueue();
+  auto gestures = gestureRecognizer(inputEvents, 1000, 300, 800);
+  gestureEvent gesture;
+  auto input = [&](const inputType type, const unsigned int sample, const uint8_t stepSize = 1){
+    inputEvents.push(inputEvent{type, sample, stepSize});
+  };
+  auto recognized = [&](const gestureType type, const unsigned int now){
+    return gestures.poll(gesture, now) && gesture.type == type;
+  };
+  input(inputType::press, 0);
+  input(inputType::release, 100);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Click is reported after the double-click time: " << (!gestures.poll(gesture, 100) && !gestures.poll(gesture, 400) && recognized(gestureType::click, 401)) << hwlib::endl;
+  input(inputType::press, 1000);
+  input(inputType::release, 1100);
+  input(inputType::press, 1200);
+  input(inputType::release, 1300);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Second press within the double-click time is a double-click: " << (recognized(gestureType::doubleClick, 1300) && !gestures.poll(gesture, 2000)) << hwlib::endl;
+  input(inputType::press, 3000);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Long-press is reported while the button is held: " << (!gestures.poll(gesture, 3799) && recognized(gestureType::longPress, 3800)) << hwlib::endl;
+  input(inputType::release, 4000);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Release after a long-press is ignored: " << (!gestures.poll(gesture, 4000) && !gestures.poll(gesture, 5000)) << hwlib::endl;
+  input(inputType::press, 5000);
+  input(inputType::turnClockwise, 5100, 2);
+  input(inputType::release, 5200);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Turning while pressing is a press-and-turn with its step size: " << (recognized(gestureType::pressTurnClockwise, 5100) && gesture.stepSize == 2 && !gestures.poll(gesture, 5200) && !gestures.poll(gesture, 6000)) << hwlib::endl;
+  input(inputType::press, 7000);
+  input(inputType::release, 7100);
+  input(inputType::press, 7200);
+  input(inputType::turnCounterClockwise, 7250);
+  input(inputType::release, 7300);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Pending click is reported before a press-and-turn: " << (recognized(gestureType::click, 7250) && recognized(gestureType::pressTurnCounterClockwise, 7250) && !gestures.poll(gesture, 8000)) << hwlib::endl;
+  input(inputType::press, 9000);
+  input(inputType::release, 9100);
+  input(inputType::turnClockwise, 9150);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Pending click is reported before a turn: " << (recognized(gestureType::click, 9150) && recognized(gestureType::turnClockwise, 9150)) << hwlib::endl;
+  input(inputType::press, 10000);
+  input(inputType::release, 10100);
+  input(inputType::press, 10200);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Pending click is reported before a long-press: " << (!gestures.poll(gesture, 10999) && recognized(gestureType::click, 11000) && recognized(gestureType::longPress, 11000)) << hwlib::endl;
+  input(inputType::release, 11100);
+  gestures.useDoubleClick(false);
+  input(inputType::press, 12000);
+  input(inputType::release, 12050);
+  input(inputType::press, 12100);
+  input(inputType::release, 12150);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Click is reported right away without double-clicks: " << (recognized(gestureType::click, 12150) && recognized(gestureType::click, 12150) && !gestures.poll(gesture, 13000)) << hwlib::endl;
+  gestures.useDoubleClick(true);
+  input(inputType::press, 13000);
+  input(inputType::release, 13050);
+  const bool clickWaits = !gestures.poll(gesture, 13050);
+  gestures.useDoubleClick(false);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Pending click is reported once double-clicks aren't used: " << (clickWaits && recognized(gestureType::click, 13051)) << hwlib::endl;
+}
@@ -0,0 +1,271 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "alarmClock.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has four mandatory parameters; the radio, the presets (the wake-up tunes to one of them), the
+/// clock of which the alarms are used and the (mounted) store in which the wake-up settings are kept. The key under
+/// which they are saved defaults to 2 and the time between two volume steps to 2000 milliseconds; ramping up to
+/// volume 10 then takes 18 seconds. A moved wake-up time is saved once it hasn't been moved for 3000 milliseconds.
+alarmClock::alarmClock(RDA5807 & radio, presetStore & presets, DS3231 & clock, keyValueStore & store, const uint8_t key, const unsigned int stepInterval, const unsigned int saveDelay):
+	radio(radio),
+	presets(presets),
+	clock(clock),
+	store(store),
+	key(key),
+	stepInterval(stepInterval),
+	saveDelay(saveDelay)
+{}
+
+/// \brief
+/// Program Wake-Up
+/// \details
+/// This function sets the first alarm of the DS3231 to the wake-up time; it triggers every day when the hours,
+/// minutes and seconds match. When the wake-up is disabled, the alarm can't pull the INT/SQW pin low anymore.
+void alarmClock::programWakeUp(){
+	if(wakeUp.enabled){
+		clock.changeFirstAlarm(timeData(wakeUp.hours, wakeUp.minutes, 0), dateData());
+		clock.setFirstAlarm(8, true, true);
+	} else {
+		clock.enableAlarmInterrupts(false, sleepTimer);
+	}
+}
+
+/// \brief
+/// Save Wake-Up Settings
+/// \details
+/// This function writes the wake-up settings to the store as one record. Returns false if they couldn't be saved.
+bool alarmClock::save(){
+	unsaved = false;
+	const uint8_t bytes[recordLength] = {version, wakeUp.enabled, wakeUp.hours, wakeUp.minutes, wakeUp.preset, wakeUp.volume};
+	return store.set(key, bytes, recordLength);
+}
+
+/// \brief
+/// Load Wake-Up Settings
+/// \details
+/// This function reads the wake-up settings from the store and sets the first alarm accordingly. Returns false, and
+/// disables the wake-up, when no settings of this version have been saved yet.
+bool alarmClock::load(){
+	uint8_t bytes[recordLength];
+	const bool found = store.get(key, bytes, recordLength) == recordLength && bytes[0] == version;
+	if(found){
+		wakeUp.enabled = bytes[1];
+		wakeUp.hours = bytes[2];
+		wakeUp.minutes = bytes[3];
+		wakeUp.preset = bytes[4];
+		wakeUp.volume = bytes[5];
+	} else {
+		wakeUp = wakeUpSettings();
+	}
+	programWakeUp();
+	return found;
+}
+
+/// \brief
+/// Set Wake-Up Settings
+/// \details
+/// This function changes the wake-up settings, sets the first alarm accordingly and saves them. The hours, minutes and
+/// volume are limited to 23, 59 and 15. Returns false if they couldn't be saved.
+bool alarmClock::setWakeUp(const wakeUpSettings & settings){
+	wakeUp = settings;
+	wakeUp.hours = (wakeUp.hours > 23) ? 23 : wakeUp.hours;
+	wakeUp.minutes = (wakeUp.minutes > 59) ? 59 : wakeUp.minutes;
+	wakeUp.volume = (wakeUp.volume > 15) ? 15 : wakeUp.volume;
+	programWakeUp();
+	return save();
+}
+
+/// \brief
+/// Get Wake-Up Settings
+/// \details
+/// This function returns the current wake-up settings.
+const wakeUpSettings & alarmClock::getWakeUp(){
+	return wakeUp;
+}
+
+/// \brief
+/// Move Wake-Up Time
+/// \details
+/// This function moves the wake-up time the given amount of minutes forward (or backward when negative), within a day,
+/// and enables the wake-up. The first alarm is set right away, but the settings are only saved by poll() once the
+/// time hasn't been moved for 'saveDelay' milliseconds; turning the knob then costs one write instead of dozens.
+/// The time is in milliseconds.
+void alarmClock::moveWakeUp(const int minutes, const uint_fast64_t now){
+	const int day = 24 * 60;
+	const int moved = ((wakeUp.hours * 60 + wakeUp.minutes + minutes) % day + day) % day;
+	wakeUp.hours = moved / 60;
+	wakeUp.minutes = moved % 60;
+	wakeUp.enabled = true;
+	programWakeUp();
+	unsaved = true;
+	lastMove = now;
+}
+
+/// \brief
+/// Poll
+/// \details
+/// This function saves the moved wake-up time once it hasn't been moved for 'saveDelay' milliseconds. The time is in
+/// milliseconds. Returns true when the settings have been saved.
+bool alarmClock::poll(const uint_fast64_t now){
+	if(!unsaved || now - lastMove < saveDelay){
+		return false;
+	}
+	return save();
+}
+
+/// \brief
+/// Is Save Pending
+/// \details
+/// This function returns true if the wake-up time has been moved, but hasn't been saved yet.
+bool alarmClock::isSavePending(){
+	return unsaved;
+}
+
+/// \brief
+/// Start Sleep Timer
+/// \details
+/// This function sets the second alarm of the DS3231 to the given amount of minutes (at most a day) after the given
+/// time. When it triggers, the radio fades out and goes into standBy. Since the second alarm has no seconds register,
+/// the timer ends at the start of the minute.
+void alarmClock::startSleepTimer(const timeData & now, const unsigned int minutes){
+	const unsigned int end = (now.getHours() * 60 + now.getMinutes() + minutes) % (24 * 60);
+	clock.changeSecondAlarm(timeData(end / 60, end % 60, 0), dateData());
+	clock.setSecondAlarm(4, true, true);
+	sleepTimer = true;
+}
+
+/// \brief
+/// Cancel Sleep Timer
+/// \details
+/// This function stops the sleep timer; the second alarm can't pull the INT/SQW pin low anymore.
+void alarmClock::cancelSleepTimer(){
+	sleepTimer = false;
+	clock.enableAlarmInterrupts(wakeUp.enabled, false);
+	clock.clearAlarm(2);
+}
+
+/// \brief
+/// Sleep Timer Running
+/// \details
+/// This function returns true if the sleep timer has been started and hasn't ended or been cancelled yet.
+bool alarmClock::sleepTimerRunning(){
+	return sleepTimer;
+}
+
+/// \brief
+/// Handle Triggered Alarms
+/// \details
+/// This function handles the given triggered alarms; bit 0 for the first (wake-up) and bit 1 for the second (sleep
+/// timer) alarm, as returned by clockService::takeAlarms(). The sleep timer starts fading out from the current volume;
+/// its alarm can't pull the INT/SQW pin low anymore, otherwise it would trigger at the same time every day. The
+/// wake-up brings the radio out of standBy, unmutes it, tunes to the preset and starts ramping up from volume 1.
+/// When both triggered, the wake-up wins. The time is in milliseconds. Returns true when ramping or fading has started;
+/// step() has to be called from then on.
+bool alarmClock::handle(const unsigned int alarms, const uint_fast64_t now){
+	bool started = false;
+	if(alarms & 0x02){
+		clock.enableAlarmInterrupts(wakeUp.enabled, false);
+		if(sleepTimer && state != alarmState::asleep){
+			volume = radio.getVolume();
+			sleepVolume = volume;
+			state = alarmState::fadingOut;
+			nextStep = now + stepInterval;
+			started = true;
+		}
+		sleepTimer = false;
+	}
+	if((alarms & 0x01) && wakeUp.enabled){
+		radio.standBy(false);
+		if(wakeUp.preset < presets.getAmount()){
+			radio.setFrequency(presets.get(wakeUp.preset).getFrequency());
+		}
+		radio.setMute(false);
+		volume = 1;					//Volume 0 is equivalent to mute
+		radio.setVolume(volume);
+		targetVolume = (wakeUp.volume > 0) ? wakeUp.volume : 1;
+		state = alarmState::wakingUp;
+		nextStep = now + stepInterval;
+		started = true;
+	}
+	return started;
+}
+
+/// \brief
+/// Step
+/// \details
+/// This function takes one volume step once every 'stepInterval' milliseconds; up while waking up and down while fading
+/// out. After the last step of fading out, the radio is put into standBy. The time is in milliseconds. Returns true
+/// as long as there are steps left to take.
+bool alarmClock::step(const uint_fast64_t now){
+	if(!isBusy()){
+		return false;
+	}
+	if(now < nextStep){
+		return true;
+	}
+	nextStep = now + stepInterval;
+	if(state == alarmState::wakingUp){
+		if(volume < targetVolume){
+			radio.setVolume(++volume);
+		}
+		if(volume >= targetVolume){
+			state = alarmState::playing;
+			return false;
+		}
+	} else {
+		if(volume > 1){
+			radio.setVolume(--volume);
+		} else {
+			radio.standBy(true);
+			state = alarmState::asleep;
+			return false;
+		}
+	}
+	return true;
+}
+
+/// \brief
+/// Wake
+/// \details
+/// This function ends ramping, fading and sleeping right away; for when the user turns or presses the knob. A radio
+/// that is fading out or asleep continues at the volume it had before fading out; a radio that is waking up jumps to
+/// its final volume.
+void alarmClock::wake(){
+	if(state == alarmState::wakingUp){
+		radio.setVolume(targetVolume);
+	} else if(state == alarmState::fadingOut || state == alarmState::asleep){
+		if(radio.isStandBy()){
+			radio.standBy(false);
+		}
+		radio.setVolume(sleepVolume);
+	}
+	state = alarmState::playing;
+}
+
+/// \brief
+/// Get State
+/// \details
+/// This function returns whether the radio is playing, waking up, fading out or asleep; see alarmState.
+alarmState alarmClock::getState(){
+	return state;
+}
+
+/// \brief
+/// Is Busy
+/// \details
+/// This function returns true while the volume is being ramped up or faded out; step() has to be called then.
+bool alarmClock::isBusy(){
+	return state == alarmState::wakingUp || state == alarmState::fadingOut;
+}
+
+/// \brief
+/// Is Asleep
+/// \details
+/// This function returns true if the sleep timer has ended and the radio is in standBy.
+bool alarmClock::isAsleep(){
+	return state == alarmState::asleep;
+}
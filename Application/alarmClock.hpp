@@ -0,0 +1,118 @@
+/// @file
+
+#ifndef __ALARM_CLOCK_HPP
+#define __ALARM_CLOCK_HPP
+
+#include "RDA5807.hpp"
+#include "DS3231.hpp"
+#include "presetStore.hpp"
+#include "keyValueStore.hpp"
+
+/// \brief
+/// Wake-Up Settings
+/// \details
+/// This struct contains the moment (hours and minutes) at which the radio wakes up, the preset it tunes to and the
+/// volume it ends up at. The wake-up only happens when it is enabled.
+struct wakeUpSettings{
+	bool enabled = false;
+	uint8_t hours = 7;
+	uint8_t minutes = 0;
+	uint8_t preset = 0;
+	uint8_t volume = 10;
+};
+
+/// \brief
+/// Alarm Clock State
+/// \details
+/// These are the states of the alarmClock; playing (nothing to do), ramping the volume up after a wake-up, fading
+/// out at the end of the sleep timer and asleep (the radio is in standBy).
+enum class alarmState : uint8_t {
+	playing,
+	wakingUp,
+	fadingOut,
+	asleep
+};
+
+/// \brief
+/// Alarm Clock
+/// \details
+/// This is a class that turns the radio into an alarm clock with a sleep timer, built on the two alarms of the
+/// DS3231. The first alarm is the wake-up; every day at the set time the radio comes out of standBy, tunes to the
+/// set preset and ramps the volume up one step at a time. The second alarm is the sleep timer; when it triggers
+/// the volume fades out one step at a time after which the radio goes into standBy.
+///
+/// Both alarms pull the INT/SQW pin of the DS3231 low, so nothing has to be polled over I2C while waiting for
+/// them; the triggered alarms are passed with handle() (see clockService::takeAlarms()). Only while ramping or
+/// fading, step() has to be called. The wake-up settings are kept in a keyValueStore. When the wake-up time is moved
+/// step by step, it is only saved once it hasn't been moved for 'saveDelay' milliseconds (see poll()).
+///
+///	All supported operations are:
+///		- Load Wake-Up Settings
+///		- Set and Get Wake-Up Settings
+///		- Move Wake-Up Time
+///		- Poll (save the moved wake-up time once it is stable)
+///		- Start, Cancel and Check Sleep Timer
+///		- Handle Triggered Alarms
+///		- Step (ramp or fade the volume)
+///		- Wake (leave standBy right away)
+///		- Get State
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto radioAlarm = alarmClock(radio, presets, clock, settings);
+/// radioAlarm.load();
+/// radioAlarm.startSleepTimer(wallClock.getTime(now), 30);		//Fade out in half an hour
+/// radioAlarm.moveWakeUp(-15, now);						//Wake up a quarter of an hour earlier
+/// radioAlarm.poll(now);
+///
+/// if(radioAlarm.handle(wallClock.takeAlarms(), now)){
+/// 	while(radioAlarm.step(hwlib::now_us() / 1000)){}
+/// }
+/// ~~~~~~~~~~~~~~~
+class alarmClock{
+	private:
+		static constexpr uint8_t version = 1;
+		static constexpr unsigned int recordLength = 6;
+		RDA5807 & radio;
+		presetStore & presets;
+		DS3231 & clock;
+		keyValueStore & store;
+		const uint8_t key;
+		const unsigned int stepInterval;
+		const unsigned int saveDelay;
+
+		wakeUpSettings wakeUp;
+		alarmState state = alarmState::playing;
+		bool sleepTimer = false;
+		uint8_t volume = 0;
+		uint8_t targetVolume = 0;
+		uint8_t sleepVolume = 0;			//Volume before fading out; restored when woken manually
+		uint_fast64_t nextStep = 0;
+		bool unsaved = false;
+		uint_fast64_t lastMove = 0;
+
+		void programWakeUp();
+		bool save();
+	public:
+		alarmClock(RDA5807 & radio, presetStore & presets, DS3231 & clock, keyValueStore & store, const uint8_t key = 2, const unsigned int stepInterval = 2000, const unsigned int saveDelay = 3000);
+
+		bool load();
+		bool setWakeUp(const wakeUpSettings & settings);
+		const wakeUpSettings & getWakeUp();
+		void moveWakeUp(const int minutes, const uint_fast64_t now);
+		bool poll(const uint_fast64_t now);
+		bool isSavePending();
+
+		void startSleepTimer(const timeData & now, const unsigned int minutes);
+		void cancelSleepTimer();
+		bool sleepTimerRunning();
+
+		bool handle(const unsigned int alarms, const uint_fast64_t now);
+		bool step(const uint_fast64_t now);
+		void wake();
+
+		alarmState getState();
+		bool isBusy();
+		bool isAsleep();
+};
+
+#endif //__ALARM_CLOCK_HPP
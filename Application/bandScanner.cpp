@@ -0,0 +1,170 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "bandScanner.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the radio. The first and last channel (in tenths of MHz) default to the
+/// European FM band; 87.0MHz to 108.0MHz with a spacing of 100kHz.
+bandScanner::bandScanner(RDA5807 & radio, const unsigned int firstChannel, const unsigned int lastChannel):
+	radio(radio),
+	firstChannel(firstChannel),
+	amountOfChannels((lastChannel > firstChannel) ? lastChannel - firstChannel + 1 : 1)
+{}
+
+/// \brief
+/// Column Of Channel
+/// \details
+/// This function returns the column the given channel (index from the first channel) belongs to.
+unsigned int bandScanner::columnOf(const unsigned int channelIndex){
+	return channelIndex * columns / amountOfChannels;
+}
+
+/// \brief
+/// Finish Scan
+/// \details
+/// This function tunes the radio back to the frequency it was tuned to before the scan and restores mute. Unlike the steps,
+/// this waits until the radio has been tuned, once.
+void bandScanner::finish(){
+	scanning = false;
+	tuning = false;
+	radio.setFrequency(previousFrequency + 0.02);		//0.02 extra to compensate for autotune
+	radio.setMute(previousMute);
+}
+
+/// \brief
+/// Start Scan
+/// \details
+/// This function clears the results and starts a new scan at the first channel. The tuned frequency is remembered.
+void bandScanner::start(){
+	if(scanning){
+		return;
+	}
+	for(unsigned int i = 0; i < columns; i++){
+		strength[i] = 0;
+		bestChannel[i] = firstChannel + (i * amountOfChannels + amountOfChannels / 2) / columns;
+	}
+	previousFrequency = radio.getFrequency();
+	previousMute = radio.isMuted();
+	radio.setMute(true);
+	channel = 0;
+	updatedColumn = -1;
+	tuning = false;
+	scanning = true;
+}
+
+/// \brief
+/// Stop Scan
+/// \details
+/// This function stops a running scan; the results so far are kept and the radio is tuned back.
+void bandScanner::stop(){
+	if(scanning){
+		finish();
+	}
+}
+
+/// \brief
+/// Scan Step
+/// \details
+/// This function does one step of the scan. When the radio has finished tuning to the current channel, its signal strength
+/// is taken from the same status read and tuning to the next channel is started. It returns true if the strength of a
+/// column has been updated; the column can be asked with getUpdatedColumn(). When the radio is still tuning, only the
+/// status has been read. A step never waits on the radio; it costs at most one read and one write of a register.
+bool bandScanner::step(){
+	if(!scanning){
+		return false;
+	}
+	bool updated = false;
+	if(tuning){
+		if(!radio.tuneCompleted()){
+			return false;
+		}
+		const unsigned int measured = radio.getMeasuredStrength();
+		const unsigned int column = columnOf(channel);
+		if(measured > strength[column] || channel == 0 || columnOf(channel - 1) != column){
+			strength[column] = measured;
+			bestChannel[column] = firstChannel + channel;
+		}
+		updatedColumn = column;
+		updated = true;
+		channel++;
+		tuning = false;
+		if(channel >= amountOfChannels){
+			finish();
+			return updated;
+		}
+	}
+	radio.startTune((firstChannel + channel) / 10.0 + 0.02);	//0.02 extra to compensate for autotune
+	tuning = true;
+	return updated;
+}
+
+/// \brief
+/// Is Scanning
+/// \details
+/// This function returns true while a scan is running.
+bool bandScanner::isScanning(){
+	return scanning;
+}
+
+/// \brief
+/// Get Updated Column
+/// \details
+/// This function returns the column that has been updated by the last step() that returned true; -1 before that.
+int bandScanner::getUpdatedColumn(){
+	return updatedColumn;
+}
+
+/// \brief
+/// Get Amount of Columns
+/// \details
+/// This function returns the amount of columns the band is divided over; 128.
+unsigned int bandScanner::getColumns(){
+	return columns;
+}
+
+/// \brief
+/// Get Strength
+/// \details
+/// This function returns the signal strength (RDA5807 scale; 0 to 127) of the strongest channel in the given column.
+unsigned int bandScanner::getStrength(const unsigned int column){
+	return (column < columns) ? strength[column] : 0;
+}
+
+/// \brief
+/// Get Frequency
+/// \details
+/// This function returns the frequency (in tenths of MHz) of the strongest channel in the given column. Before the column
+/// has been measured, it is the channel in the middle of the column.
+unsigned int bandScanner::getFrequency(const unsigned int column){
+	return (column < columns) ? bestChannel[column] : firstChannel;
+}
+
+/// \brief
+/// Find Next Peak
+/// \details
+/// This function returns the first column after (up is true) or before (up is false) the given column that is a peak;
+/// stronger than its neighbours and at least half as strong as the strongest column. When there is no such column,
+/// the given column is returned.
+unsigned int bandScanner::nextPeak(const unsigned int column, const bool up){
+	unsigned int strongest = 0;
+	for(unsigned int i = 0; i < columns; i++){
+		if(strength[i] > strongest){
+			strongest = strength[i];
+		}
+	}
+	int i = int(column);
+	for(;;){
+		i += up ? 1 : -1;
+		if(i < 0 || i >= int(columns)){
+			return column;
+		}
+		const unsigned int left = (i > 0) ? strength[i - 1] : 0;
+		const unsigned int right = (i < int(columns) - 1) ? strength[i + 1] : 0;
+		if(strength[i] > 0 && strength[i] * 2 >= strongest && strength[i] >= left && strength[i] > right){
+			return i;
+		}
+	}
+}
@@ -0,0 +1,68 @@
+/// @file
+
+#ifndef __BAND_SCANNER_HPP
+#define __BAND_SCANNER_HPP
+
+#include "RDA5807.hpp"
+
+/// \brief
+/// Band Scanner
+/// \details
+/// This is a class that measures the signal strength of every channel of the FM band, one channel per step. A step starts
+/// tuning with RDA5807::startTune() and polls the tune-complete flag in later steps, so it never waits on the radio; a
+/// step in which the radio hasn't finished tuning yet only reads the status. Starting and finishing the scan (muting and
+/// tuning back) do wait on the radio, once. The band is divided over 128 columns (the width of the screen); every column
+/// keeps the strongest channel that falls in it. Once the scan is done, the radio is tuned back to the frequency it was
+/// tuned to before, and the peaks can be looked up to tune to directly. The radio is muted while scanning.
+///
+///	All supported operations are:
+///		- Start/Stop Scan
+///		- Scan Step
+///		- Get Updated Column
+///		- Get Strength and Frequency per Column
+///		- Find Next Peak
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto scanner = bandScanner(radio);
+/// scanner.start();
+/// while(scanner.isScanning()){
+/// 	if(scanner.step()){
+/// 		auto column = scanner.getUpdatedColumn();
+/// 		hwlib::cout << scanner.getFrequency(column) << ": " << scanner.getStrength(column) << hwlib::endl;
+/// 	}
+/// }
+/// radio.setFrequency(scanner.getFrequency(scanner.nextPeak(0, true)) / 10.0);
+/// ~~~~~~~~~~~~~~~
+class bandScanner{
+	private:
+		static constexpr unsigned int columns = 128;
+		RDA5807 & radio;
+		const unsigned int firstChannel;
+		const unsigned int amountOfChannels;
+		uint8_t strength[columns] = {};
+		uint16_t bestChannel[columns] = {};
+		unsigned int channel = 0;
+		bool scanning = false;
+		bool tuning = false;
+		int updatedColumn = -1;
+		float previousFrequency = 0;
+		bool previousMute = false;
+
+		unsigned int columnOf(const unsigned int channelIndex);
+		void finish();
+	public:
+		bandScanner(RDA5807 & radio, const unsigned int firstChannel = 870, const unsigned int lastChannel = 1080);
+
+		void start();
+		void stop();
+		bool step();
+		bool isScanning();
+
+		int getUpdatedColumn();
+		unsigned int getColumns();
+		unsigned int getStrength(const unsigned int column);
+		unsigned int getFrequency(const unsigned int column);
+		unsigned int nextPeak(const unsigned int column, const bool up);
+};
+
+#endif //__BAND_SCANNER_HPP
@@ -0,0 +1,127 @@
+/// @file
+
+#ifndef __LAYOUT_HPP
+#define __LAYOUT_HPP
+
+/// \brief
+/// Screen Area
+/// \details
+/// This is a compile-time description of a rectangle on the 128x64 screen; from (x0, y0) up to (not including)
+/// (x1, y1). Nothing is stored; it is a type, so it can be used as template parameter. An area that doesn't fit on
+/// the screen doesn't compile.
+template<int x0, int y0, int x1, int y1>
+struct screenArea{
+	static_assert(x0 >= 0 && y0 >= 0 && x0 < x1 && y0 < y1 && x1 <= 128 && y1 <= 64, "Area has to be on the 128x64 screen");
+	static constexpr int width = x1 - x0;
+	static constexpr int height = y1 - y0;
+
+	static hwlib::xy start(){
+		return hwlib::xy(x0, y0);
+	}
+
+	static hwlib::xy end(){
+		return hwlib::xy(x1, y1);
+	}
+};
+
+/// \brief
+/// Layout
+/// \details
+/// These are the areas of the screen in which all parts of the GUI are shown. The areas of the normal GUI don't overlap;
+/// a widget clears its own area before drawing, which would otherwise erase a neighbour that isn't redrawn.
+namespace layout{
+	using time = screenArea<0, 0, 40, 10>;
+	using battery = screenArea<89, 0, 106, 10>;
+	using signal = screenArea<108, 0, 128, 15>;
+	using frequency = screenArea<5, 20, 128, 40>;
+	using menu = screenArea<0, 40, 128, 50>;
+	using stereo = screenArea<0, 54, 20, 64>;
+	using station = screenArea<50, 54, 128, 64>;
+	using settings = screenArea<0, 0, 128, 64>;
+	using spectrum = screenArea<0, 0, 128, 54>;
+	using spectrumInfo = screenArea<0, 56, 128, 64>;
+}
+
+/// \brief
+/// Shared Font
+/// \details
+/// This function returns the one instance of the given font type. All fields with the same font share it, instead
+/// of every field having a copy of its own.
+template<typename fontType>
+const hwlib::font & sharedFont(){
+	static const fontType font;
+	return font;
+}
+
+/// \brief
+/// Placed Window
+/// \details
+/// This is a window part of which the position is fixed at compile time by the given screenArea.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto timeWindow = placedWindow<layout::time>(oled);
+/// auto timeField = hwlib::terminal_from(timeWindow, sharedFont<hwlib::font_default_8x8>());
+/// ~~~~~~~~~~~~~~~
+template<typename area>
+class placedWindow : public hwlib::window_part {
+	public:
+		placedWindow(hwlib::window & display):
+			window_part(display, area::start(), area::end())
+		{}
+};
+
+/// \brief
+/// Placed Window Holder
+/// \details
+/// This struct owns a placedWindow. Since it is the first base class of placed and placedText, the window exists
+/// before the widget that draws in it is constructed.
+///
+/// Used internally by placed and placedText.
+template<typename area>
+struct placedWindowHolder{
+	placedWindow<area> part;
+
+	placedWindowHolder(hwlib::window & display):
+		part(display)
+	{}
+};
+
+/// \brief
+/// Placed Widget
+/// \details
+/// This is the given widget, drawing in its own window at the given screenArea. The remaining constructor
+/// parameters are passed to the widget.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto signal = placed<barIndicator, layout::signal>(oled, hwlib::xy(2, 8));
+/// ~~~~~~~~~~~~~~~
+template<typename widgetType, typename area>
+class placed : private placedWindowHolder<area>, public widgetType {
+	public:
+		template<typename... argumentTypes>
+		placed(hwlib::window & display, argumentTypes... arguments):
+			placedWindowHolder<area>(display),
+			widgetType(this->part, arguments...)
+		{}
+};
+
+/// \brief
+/// Placed Text Widget
+/// \details
+/// This is the given text widget, drawing in its own window at the given screenArea with the shared instance of
+/// the given font. The remaining constructor parameters are passed to the widget.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto stereo = placedText<label, layout::stereo, hwlib::font_default_8x8>(oled, "MN");
+/// ~~~~~~~~~~~~~~~
+template<typename widgetType, typename area, typename fontType>
+class placedText : private placedWindowHolder<area>, public widgetType {
+	public:
+		template<typename... argumentTypes>
+		placedText(hwlib::window & display, argumentTypes... arguments):
+			placedWindowHolder<area>(display),
+			widgetType(this->part, sharedFont<fontType>(), arguments...)
+		{}
+};
+
+#endif //__LAYOUT_HPP
@@ -5,40 +5,40 @@
 #include "KY040.hpp"
 #include "A24C256.hpp"
 #include "DS3231.hpp"
-
-void setTestPresets(A24C256 & memory){
-  //4 Presets:
-  memory.write(0, 4);
-
-  //Q-Music, 100.7
-  memory.write(1, 100);
-  memory.write(2, 7);
-  char Qdata[]={"Q-Music "};    //Space to make sure no data at next index. Entire memory is filled with testcode.
-  memory.write(3, Qdata);
-
-  //Sky Radio 101.2
-  memory.write(11, 101);
-  memory.write(12, 2);
-  char Sdata[]={"SKYRADIO"};
-  memory.write(13, Sdata);
-
-  //Midland FM, 107.5
-  memory.write(21, 107);
-  memory.write(22, 5);
-  char Mdata[]={"MIDLAND "};
-  memory.write(23, Mdata);
-
-  //Radio 538, 100.1
-  memory.write(31, 100);
-  memory.write(32, 1);
-  char Rdata[]={"RADIO538"};
-  memory.write(33, Rdata);
+#include "clockService.hpp"
+#include "SSD1306.hpp"
+#include "busScheduler.hpp"
+#include "busTracer.hpp"
+#include "taskScheduler.hpp"
+#include "sampleTimer.hpp"
+#include "inputSampler.hpp"
+#include "gestureRecognizer.hpp"
+#include "menu.hpp"
+#include "refreshGovernor.hpp"
+#include "bandScanner.hpp"
+#include "presetStore.hpp"
+#include "keyValueStore.hpp"
+#include "resumeState.hpp"
+#include "bootSequence.hpp"
+#include "radioDataCache.hpp"
+#include "alarmClock.hpp"
+
+void setTestPresets(presetStore & presets){
+  presets.format();
+  presets.add(preset(100.7, "Q-Music"));
+  presets.add(preset(101.2, "SKYRADIO"));
+  presets.add(preset(107.5, "MIDLAND"));
+  presets.add(preset(100.1, "RADIO538"));
 }
 
-
 int main( void ){
+  //When set to true, enables output of what the application and user are doing. When disabled, nothing will be printed
+  //in the terminal.
   bool displayDebugInfo = true;
 
+  //All times of the boot timeline are relative to this moment; right after power-on.
+  auto boot = bootSequence();
+
   namespace target = hwlib::target;
 
 //                        Interfaces
@@ -46,300 +46,398 @@ int main( void ){
   auto CLK = hwlib::target::pin_in( hwlib::target::pins::d36 );
   auto DT = hwlib::target::pin_in( hwlib::target::pins::d38 );
   auto SW = hwlib::target::pin_in( hwlib::target::pins::d40 );
+  auto clockInterrupt = hwlib::target::pin_in( hwlib::target::pins::d42 );    //INT/SQW of the DS3231; needs a pull-up
 
   auto scl = target::pin_oc( target::pins::d8 );
   auto sda = target::pin_oc( target::pins::d9 );
-  auto i2c_bus = hwlib::i2c_bus_bit_banged_scl_sda(scl, sda);
+  auto i2c_bus = busTracer(scl, sda);   //Keeps track of all I2C traffic; press a key in the terminal to print it
+  i2c_bus.addDriver("RDA5807", 0x10);
+  i2c_bus.addDriver("RDA5807", 0x11);
+  i2c_bus.addDriver("SSD1306", 0x3C);
+  i2c_bus.addDriver("A24C256", 0x50);
+  i2c_bus.addDriver("DS3231", 0x68);
+
+  auto memory = A24C256(i2c_bus);
+  auto settings = keyValueStore(memory, 4096, 1024);
+  auto resume = resumeState(settings);
+  resumeRecord state;
+  bool resumed = false;
+  auto presets = presetStore(memory);
+  auto stations = radioDataCache(memory, 8192);
+  stationInfo cachedStation;
 
   auto radio = RDA5807(i2c_bus);
-  radio.begin();
 
-  auto oled = hwlib::glcd_oled( i2c_bus, 0x3C );
+  auto oled = SSD1306(i2c_bus);
 
   auto button = KY040(CLK, DT, SW);
 
-  auto memory = A24C256(i2c_bus);
-
   auto clock = DS3231(i2c_bus);
+  auto wallClock = clockService(clock);     //Only reads the DS3231 when the minute changes
+  auto radioAlarm = alarmClock(radio, presets, clock, settings);     //Wake-up on the first, sleep timer on the second alarm
+  const unsigned int sleepMinutes = 30;
   unsigned int lastMinutes = 0;
   timeData time;
   dateData date;
 
-//                        Window Parts
+//                        Bus Arbitration
 //<<<--------------------------------------------------------->>
-  auto frequencyArea = hwlib::window_part(oled, hwlib::xy( 0, 0 ), hwlib::xy( 30, 10 ));   
-  auto font = hwlib::font_default_8x8();
-  //auto textArea = hwlib::terminal_from(frequencyArea, font);
-
-  auto window = hwlib::window_part(oled, hwlib::xy(0, 0), hwlib::xy(128, 64));
-
-  auto stereoWindow = hwlib::window_part(oled, hwlib::xy(0, 54), hwlib::xy(20, 64));
-  auto stereoFont = hwlib::font_default_8x8();
-  auto stereoField = hwlib::terminal_from(stereoWindow, stereoFont);
-
-  auto timeWindow = hwlib::window_part(oled, hwlib::xy(0, 0), hwlib::xy(40, 10));
-  auto timeFont = hwlib::font_default_8x8();
-  auto timeField = hwlib::terminal_from(timeWindow, timeFont);
-
-  auto frequencyWindow = hwlib::window_part(oled, hwlib::xy(5, 20), hwlib::xy(128, 45));
-  auto frequencyFont = hwlib::font_default_16x16();
-  auto frequencyField = hwlib::terminal_from(frequencyWindow, frequencyFont);
-
-  auto stationWindow = hwlib::window_part(oled, hwlib::xy(50, 54), hwlib::xy(128, 64));
-  auto stationFont = hwlib::font_default_8x8();
-  auto stationField = hwlib::terminal_from(stationWindow, stationFont);
-
-  auto menuWindow = hwlib::window_part(oled, hwlib::xy(0, 40), hwlib::xy(128, 50));
-  auto menuFont = hwlib::font_default_8x8();
-  auto menuField = hwlib::terminal_from(menuWindow, menuFont);
-
-  auto settingsWindow = hwlib::window_part(oled, hwlib::xy(0, 0), hwlib::xy(128, 64));
-  auto settingsFont = hwlib::font_default_8x8();
-  auto settingsField = hwlib::terminal_from(settingsWindow, settingsFont);
+  //All chips share one bus. Reads are done through the scheduler so they never have to wait on a complete
+  //display flush; the display is flushed in chunks with the lowest priority.
+  auto bus = busScheduler();
+  unsigned int signalStrength = 0;
+  bool stereo = false;
+  float frequency = 0;
+  //All changes are coalesced into at most 10 frames per second; 1 per second when only background values changed.
+  auto governor = refreshGovernor(10, 1);
+  auto radioDataCapture = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "radioDataSystem", "radioDataCapture");
+    radio.radioData.update();
+    //The decoded Radio Data is only written to the cache once it is stable and differs from what has been stored.
+    stationInfo decoded;
+    decoded.frequency = frequency * 1000 + 0.5;
+    decoded.programIdentification = radio.radioData.getProgramIdentification();
+    decoded.setName(radio.radioData.stationName());
+    decoded.programType = radio.radioData.getProgramType();
+    decoded.amountOfAlternatives = 0;
+    while(decoded.amountOfAlternatives < radio.radioData.getAmountOfAlternatives() && decoded.amountOfAlternatives < stationInfo::maxAlternatives){
+      decoded.alternatives[decoded.amountOfAlternatives] = radio.radioData.getAlternativeFrequency(decoded.amountOfAlternatives);
+      decoded.amountOfAlternatives++;
+    }
+    //The decoded name is shown as soon as it has been received the same twice; until then the cached name stays.
+    bool named = false;
+    bool renamed = false;
+    for(unsigned int i = 0; i < 8; i++){
+      named |= decoded.name[i] != ' ';
+      renamed |= decoded.name[i] != cachedStation.name[i];
+    }
+    if(named && renamed){
+      cachedStation.setName(decoded.name);
+      governor.request(refreshReason::station, hwlib::now_us() / 1000);
+    }
+    if(stations.observe(decoded)){
+      if(displayDebugInfo){
+        hwlib::cout << "Cached the Radio Data of " << decoded.name << hwlib::endl;
+      }
+    }
+    return true;
+  });
+  auto signalSample = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "signalSample");
+    const unsigned int newSignalStrength = radio.signalStrength();
+    const bool newStereo = radio.stereoReception();
+    const float newFrequency = radio.getFrequency();
+    if(newFrequency != frequency){
+      governor.request(refreshReason::frequency, hwlib::now_us() / 1000);
+    }
+    if(newSignalStrength != signalStrength || newStereo != stereo){
+      governor.request(refreshReason::signal, hwlib::now_us() / 1000);
+    }
+    governor.setBusy(!radio.seekCompleted());     //No frames while tuning or seeking
+    signalStrength = newSignalStrength;
+    stereo = newStereo;
+    frequency = newFrequency;
+    return true;
+  });
+  auto clockRead = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "DS3231", "clockRead");
+    if(wallClock.poll(hwlib::now_us() / 1000)){
+      time = wallClock.getTime(hwlib::now_us() / 1000);
+      date = wallClock.getDate();
+      if(time.getMinutes() != lastMinutes){
+        governor.request(refreshReason::clock, hwlib::now_us() / 1000);
+      }
+    }
+    return true;
+  });
+  bus.add(radioDataCapture, busPriority::radioData, "RDS Capture");
+  bus.add(signalSample, busPriority::signal, "RSSI Sample");
+  bus.add(clockRead, busPriority::clock, "Clock Read");
+  bus.add(oled, busPriority::display, "Display Flush");
+  oled.attach(bus);
 
-  auto signalWindow = hwlib::window_part(oled, hwlib::xy(108, 0), hwlib::xy(128, 15));
-  auto batteryWindow = hwlib::window_part(oled, hwlib::xy(90, 0), hwlib::xy(105, 10));
+//                        Window Parts
+//<<<--------------------------------------------------------->>
+  auto timeWindow = placedWindow<layout::time>(oled);
+  auto timeField = hwlib::terminal_from(timeWindow, sharedFont<hwlib::font_default_8x8>());
 
 //                        Initialization
 //<<<--------------------------------------------------------->>>
-  auto display = GUI(window, oled, button, stereoField, signalWindow, batteryWindow, frequencyField, menuField, settingsField, stationField);
-
-  radio.setFrequency(100.7);
-  hwlib::wait_ms(3000);
+  auto display = GUI(oled);
+  display.setRadioText(radio.radioData.stationText());
   button.setPos(0);
 
-  setTestPresets(memory);
-
   auto battery = hwlib::target::pin_adc(0);
 
-//                        Menu Navigation Handling
-//<<<-------------------------------------------------------->>>
-  bool inPressedArea = false;
-  unsigned int iterations = 0;
-  int lastKnownPos = 0;
-  bool wasPressed = false;
-  unsigned int menuArea = 0;      //0 for autoSearch, 1 for manualSearch, 2 for presets, etc.
-  bool firstTimeFrequency = false;
-  bool bassBoost = false;
-  bool showRadioDataStationName = true;
-  bool curMute = false;
-  bool needToUpdate = false;
-  timeData alarmTime = clock.getTime();
-
-//                        Retrieving Saved Stations from Memory
+//                        Boot Sequence
 //<<<-------------------------------------------------------------------------->>>
-  int amountOfPresets = memory.read(0);
-  int curTunedPreset = 0;
-  int lastCheckedPreset = curTunedPreset - 1; //To force update
-  uint8_t newData[] = {"         "};
-
-  std::array<float, 20> stations = {};    //A total of 20 stations can be saved and thus, retrieved.
-
-  //Index 1 contains first whole digit from frequency as int, 2 contains comma number 3 - 10 contain the name. 11 and 12 contain frequency 13 - 20 contain the name. etc.
-
-  for(int i = 0; i < amountOfPresets; i++){
-    stations[i] = float(memory.read(i * 10 + 1) * 10 + (memory.read(i * 10 + 2))) / 10;
+  //Starting up is split in stages that are interleaved. The radio needs one second after power-up before it can be
+  //initialized; in the meantime the state to resume from, the presets and the clock are read and the first frame is
+  //shown. The first frame is sent in chunks, so the radio can be initialized in between.
+  int lastCheckedPreset = -1; //To force update
+  const char* stationName = nullptr;
+
+  //The state in which the radio was turned off is read first, so it plays the last station as soon as it has started.
+  auto settingsLoad = bootFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "A24C256", "settingsLoad");
+    settings.mount();
+    resumed = resume.load(state);
+    return true;
+  });
+
+  //All presets are read with one transaction; the names are taken from RAM from now on.
+  auto presetLoad = bootFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "A24C256", "presetLoad");
+    if(!presets.load()){
+      setTestPresets(presets);    //Only when there are no valid presets yet
+    }
+    stationName = presets.get(0).name;
+    return true;
+  });
+
+  //The name of the station to resume is known before any Radio Data has been received.
+  auto stationLoad = bootFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "A24C256", "stationLoad");
+    stations.load();
+    if(stations.find(state.frequency * 1000 + 0.5, cachedStation)){
+      stationName = cachedStation.name;
+    }
+    return true;
+  });
+
+  auto clockLoad = bootFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "DS3231", "clockLoad");
+    wallClock.synchronize(hwlib::now_us() / 1000);
+    wallClock.useAlarmInterrupt();      //The alarms pull INT/SQW low; the seconds are counted locally
+    radioAlarm.load();
+    time = wallClock.getTime(hwlib::now_us() / 1000);
+    date = wallClock.getDate();
+    return true;
+  });
+
+  //The frequency to resume is shown before the radio plays it.
+  bool frameRequested = false;
+  auto firstFrame = bootFunction([&](){
+    if(!frameRequested){
+      frameRequested = true;
+      display.displayMenuUpdate(30, state.frequency * 10, false, 38, false, 1, radio, true, stationName, state.muted, date, true);   //Force updates
+      lastMinutes = time.getMinutes();
+      timeField << time.getHours() << ":" << time.getMinutes() << hwlib::flush;
+    }
+    bus.run();      //One chunk of the frame
+    return !oled.flushPending();
+  });
+
+  unsigned int radioStep = 0;
+  auto radioStart = bootFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "radioStart");
+    switch(radioStep++){
+      case 0:
+        radio.begin(state.muted, 0);      //The power-up time has been waited for by the boot sequence
+        return false;
+      case 1:
+        radio.setVolume(state.volume);
+        radio.setBassBoost(state.bassBoost);
+        return false;
+      default:
+        radio.setFrequency(state.frequency);
+        return true;
+    }
+  });
+
+  boot.add(settingsLoad, "Settings");
+  boot.add(radioStart, "Radio", &settingsLoad, 1000);
+  boot.add(presetLoad, "Presets", &settingsLoad);
+  boot.add(stationLoad, "Stations", &presetLoad);
+  boot.add(clockLoad, "Clock", &stationLoad);
+  boot.add(firstFrame, "First Frame", &clockLoad);
+  boot.runAll();
+  if(displayDebugInfo){
+    boot.printTimeline(hwlib::cout);
   }
 
-  //Display first stationName
-  memory.read(curTunedPreset * 10 + 2, 8, newData);
-  char* stationName = (char*)newData;
-  display.displayMenuUpdate(30, radio.getFrequency() * 10, inPressedArea, 38, false, 1, radio, showRadioDataStationName, (char*)newData, false, clock.getDate());   //Force updates
-
+//                        Input Handling
+//<<<-------------------------------------------------------->>>
+  //The encoder is sampled by a timer interrupt at 1kHz; every step and button edge is queued, so nothing is lost
+  //while the menu is busy tuning the radio. The update frequency is needed to determine the velocity of the encoder.
+  //The gesture recognizer makes clicks, double-clicks, long-presses and press-and-turns of the queued events.
+  auto inputEvents = inputQueue();
+  auto sampler = inputSampler(button, inputEvents);
+  auto samplerTimer = sampleTimer(sampler, 1000);
+  button.setUpdateFrequency(samplerTimer.getFrequency());
+  auto gestures = gestureRecognizer(inputEvents, samplerTimer.getFrequency());
+  auto scanner = bandScanner(radio);
+  auto navigation = menu(radio, presets, scanner, displayDebugInfo);
+  navigation.restore(state.area, state.muted, state.bassBoost, state.showStationName);
+  if(displayDebugInfo){
+    hwlib::cout << hwlib::boolalpha << "Resumed last state: " << resumed << hwlib::endl;
+  }
+  samplerTimer.start();
 
-  time = clock.getTime();
-  timeField << time.getHours() << ":" << time.getMinutes() << hwlib::flush;
-  for(;;){
-    iterations++;
-    button.update();
-    if(button.isPressed()){
-      while(button.isPressed()){
-        button.update();
-        hwlib::wait_ms(50);
+//                        Tasks
+//<<<-------------------------------------------------------->>>
+  //Every task has a period and a deadline in milliseconds.
+  bool wakeRequested = false;
+  auto inputHandling = taskFunction([&](){
+    samplerTimer.poll();      //Only samples when there is no timer interrupt
+    gestureEvent gesture;
+    gestures.useDoubleClick(navigation.usesDoubleClick());      //Otherwise clicks are handled without waiting
+    while(gestures.poll(gesture, sampler.getSamples())){
+      if(radioAlarm.isBusy() || radioAlarm.isAsleep()){
+        wakeRequested = true;     //The first gesture only wakes the radio; it is handled by the clock events
+        continue;
       }
-      wasPressed = true;
-      needToUpdate = true;
-      if(menuArea < 3){
-        inPressedArea = !inPressedArea;
+      auto scope = busTraceScope(i2c_bus, "RDA5807", "menu");
+      if(navigation.handle(gesture)){
+        governor.request(refreshReason::menu, hwlib::now_us() / 1000);
       }
-      if(displayDebugInfo){
-        if(inPressedArea){
-          hwlib::cout << "Button has been pressed to change settings in Menu Area " << menuArea << hwlib::endl;
-        } else {
-          hwlib::cout << "Button has been pressed to stop changing settings in Menu Area " << menuArea << hwlib::endl;
-        }
+      if(navigation.getArea() != 7){
+        display.showWakeUp(false);      //The date is shown again
       }
-    }
-    if(button.getPos() != lastKnownPos){
-      needToUpdate = true;
-      //Tuned clockwise in Pressed Area
-      if(button.getPos() > lastKnownPos && inPressedArea){
+      gestures.useDoubleClick(navigation.usesDoubleClick());
+      if(navigation.hasTuned()){
+        bus.request(signalSample);      //The new frequency should be shown as soon as possible
+      }
+      if(navigation.presetRequested()){
+        auto scope = busTraceScope(i2c_bus, "A24C256", "savePreset");
+        const uint16_t programIdentification = radio.radioData.getProgramIdentification();
+        const bool saved = presets.add(preset(radio.getFrequency(), radio.radioData.stationName(), programIdentification, radio.getVolume(), programIdentification != 0 ? presetFlags::radioData : 0));
         if(displayDebugInfo){
-          hwlib::cout << "Turned Clockwise ";
+          hwlib::cout << hwlib::boolalpha << "Saved tuned frequency as preset " << presets.getAmount() << ": " << saved << hwlib::endl;
         }
-        if(menuArea == 0){    //Auto search
-          if(displayDebugInfo){
-            hwlib::cout << "to perform Auto Search Up" << hwlib::endl;
-          }
-          radio.seekChannel(1);
-          firstTimeFrequency = true;
-          showRadioDataStationName = true;
-        } else if(menuArea == 1){  //Manual Search
-          showRadioDataStationName = false;
-          firstTimeFrequency = true;
-          auto newFrequency = radio.getFrequency() + 0.12;      //Instead of 0.1 to compensate for autotune
-          hwlib::wait_ms(30);
-          radio.setFrequency(newFrequency);
-          if(displayDebugInfo){
-            hwlib::cout << "to perform Manual Search Up to " << int(newFrequency * 10) << hwlib::endl;
-          }
-        } else if (menuArea == 2){  //Preset select
-          showRadioDataStationName = false;
-          curTunedPreset++;
-          if(curTunedPreset > amountOfPresets){
-            curTunedPreset = 0;
-          }
-          hwlib::wait_ms(30);
-          radio.setFrequency(stations[curTunedPreset]);
-          if(displayDebugInfo){
-            hwlib::cout << "to select next preset: " << int(stations[curTunedPreset] * 10)<< hwlib::endl;
-          }
+      }
+      if(navigation.sleepTimerRequested()){
+        auto scope = busTraceScope(i2c_bus, "DS3231", "sleepTimer");
+        if(radioAlarm.sleepTimerRunning()){
+          radioAlarm.cancelSleepTimer();
+        } else {
+          radioAlarm.startSleepTimer(wallClock.getTime(hwlib::now_us() / 1000), sleepMinutes);
         }
-        //Turned counter clockwise in pressed area
-      } else if (inPressedArea){    //Auto search
         if(displayDebugInfo){
-          hwlib::cout << "Turned Counter Clockwise ";
-        }
-        if(menuArea == 0){
-          if(displayDebugInfo){
-            hwlib::cout << "to perform Auto Search Down" << hwlib::endl;
-          }
-          firstTimeFrequency = true;
-          showRadioDataStationName = true;
-          radio.seekChannel(0);
-        } else if(menuArea == 1){  //Manual Search
-          firstTimeFrequency = true;
-          showRadioDataStationName = false;
-          auto newFrequency = radio.getFrequency() - 0.1;
-          hwlib::wait_ms(30);
-          radio.setFrequency(newFrequency);
-          if(displayDebugInfo){
-            hwlib::cout << "to perform Manual Search Down to " << int(newFrequency * 10) << hwlib::endl;
-          }
-        } else if (menuArea == 2){  //Preset select
-          showRadioDataStationName = false;
-          curTunedPreset--;
-          if(curTunedPreset < 0){
-            curTunedPreset = amountOfPresets - 1;
-          }
-          hwlib::wait_ms(30);
-          radio.setFrequency(stations[curTunedPreset]);
-          if(displayDebugInfo){
-            hwlib::cout << "to select previous preset: " << int(stations[curTunedPreset] * 10)<< hwlib::endl;
-          }
+          hwlib::cout << hwlib::boolalpha << "Sleep Timer of " << sleepMinutes << " minutes running: " << radioAlarm.sleepTimerRunning() << hwlib::endl;
         }
-        //Not in Pressed Area
       }
-
-      //If not in pressed area, and the button has been turned, we want to change menuArea
-      if(!inPressedArea) {
-        if(button.getPos() > lastKnownPos){
-          if(displayDebugInfo){
-            hwlib::cout << "Turned Clockwise to select Menu Area ";
-          }
-          if(menuArea == 7){
-            menuArea = 0;
-          } else {
-            menuArea++;
-          }
-        } else {
-          if(displayDebugInfo){
-            hwlib::cout << "Turned Counter Clockwise to select Menu Area ";
-          }
-          if (menuArea == 0){
-            menuArea = 7;
-          } else{
-            menuArea--;
-          }
+      if(navigation.wakeUpRequested()){
+        auto scope = busTraceScope(i2c_bus, "DS3231", "wakeUp");
+        wakeUpSettings wakeUp = radioAlarm.getWakeUp();
+        wakeUp.enabled = !wakeUp.enabled;
+        if(wakeUp.enabled){     //Wakes up at the set time every day; tuned to the last selected preset at this volume
+          wakeUp.preset = navigation.getTunedPreset();
+          wakeUp.volume = radio.getVolume();
         }
+        const bool saved = radioAlarm.setWakeUp(wakeUp);
+        display.showWakeUp(true, wakeUp.hours, wakeUp.minutes, wakeUp.enabled);
+        governor.request(refreshReason::menu, hwlib::now_us() / 1000);
+        if(displayDebugInfo){
+          hwlib::cout << hwlib::boolalpha << "Wake-Up at " << int(wakeUp.hours) << ":" << int(wakeUp.minutes) << " enabled: " << wakeUp.enabled << ", saved: " << saved << hwlib::endl;
+        }
+      }
+      const int wakeUpChange = navigation.getWakeUpChange();
+      if(wakeUpChange != 0){
+        auto scope = busTraceScope(i2c_bus, "DS3231", "wakeUp");
+        radioAlarm.moveWakeUp(wakeUpChange, hwlib::now_us() / 1000);     //Saved once it hasn't been moved for 3 seconds
+        const auto & wakeUp = radioAlarm.getWakeUp();
+        display.showWakeUp(true, wakeUp.hours, wakeUp.minutes);
         if(displayDebugInfo){
-          hwlib::cout << menuArea << hwlib::endl;
+          hwlib::cout << "Wake-Up moved to " << int(wakeUp.hours) << ":" << int(wakeUp.minutes) << hwlib::endl;
         }
       }
-      lastKnownPos = button.getPos();
     }
+  });
 
-    //Determine what has to happen when button is pressed in what area.
+  //Reads only request their bus work; it is done by the display flush task in between the chunks of the display.
+  auto signalRefresh = taskFunction([&](){
+    bus.request(signalSample);
+  });
 
-    if(menuArea == 3 && wasPressed){
-      bassBoost = !bassBoost;
-      hwlib::wait_ms(30);
-      radio.setBassBoost(bassBoost);
-      if(displayDebugInfo){
-        hwlib::cout << hwlib::boolalpha << "Pressed button to set Bass Boost to: " << bassBoost << hwlib::endl;
-      }
+  auto radioDataRefresh = taskFunction([&](){
+    if(radio.radioDataEnabled()){
+      bus.request(radioDataCapture);
     }
-
-    if(menuArea == 4 && wasPressed){
-      curMute = !curMute;
-      radio.setMute(curMute);
-      if(displayDebugInfo){
-        hwlib::cout << hwlib::boolalpha << "Pressed button to set Mute to: " << curMute << hwlib::endl;
-      }
+  });
+
+  auto clockRefresh = taskFunction([&](){
+    bus.request(clockRead);
+  });
+
+  //Every step of a band scan measures one channel; only the column it belongs to is drawn and sent.
+  auto scanStep = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "scanStep");
+    if(scanner.step()){
+      const auto column = scanner.getUpdatedColumn();
+      display.displaySpectrumColumn(column, scanner.getStrength(column));
     }
-
-    if(menuArea == 5 && wasPressed){
-      auto curRadioData = radio.radioDataEnabled();
-      hwlib::wait_ms(30);
-      radio.enableRadioData(!curRadioData);
-      if(displayDebugInfo){
-        hwlib::cout << hwlib::boolalpha << "Pressed button to set Radio Data Decoding to: " << curRadioData << hwlib::endl;
+    return true;
+  });
+  bus.add(scanStep, busPriority::signal, "Scan Step");
+
+  auto bandScan = taskFunction([&](){
+    display.showSpectrum(navigation.inBandScan());
+    if(navigation.inBandScan()){
+      if(scanner.isScanning()){
+        bus.request(scanStep);
       }
+      const auto cursor = navigation.getCursor();
+      display.displaySpectrumCursor(cursor, scanner.getFrequency(cursor));
+      display.renderSpectrum();
     }
+  });
 
-    if(menuArea == 6 && wasPressed){
-      showRadioDataStationName = !showRadioDataStationName;
-      if(displayDebugInfo){
-        hwlib::cout << hwlib::boolalpha << "Pressed button to set Radio Data Station Name to: " << showRadioDataStationName << hwlib::endl;
-      }
+  unsigned int textChanges = 0;
+  auto textScroll = taskFunction([&](){
+    if(radio.radioData.getTextChanges() != textChanges){
+      textChanges = radio.radioData.getTextChanges();
+      display.restartStationText();     //A new frequency or RadioText; new parts of the same text keep their position
     }
+    display.scrollStationText();      //Only the columns that moved are drawn
+  });
 
-    wasPressed = false;
+  auto displayFlush = taskFunction([&](){
+    bus.run();      //One chunk of pending bus work (mostly display flushes)
+  });
 
-    if(iterations > 200 && needToUpdate){
+  auto displayRefresh = taskFunction([&](){
+    if(governor.isBusy()){
+      bus.request(signalSample);      //To find out when tuning or seeking is done
+    }
+    if(governor.poll(hwlib::now_us() / 1000)){
+      display.showSpectrum(navigation.inBandScan());
       battery.refresh();
-      needToUpdate = false;
-      iterations = 0;
-      button.getPos();
+      //A tuned frequency has to be read before it can be shown.
+      while(bus.isPending(signalSample)){
+        bus.run();
+      }
       //If it is allowed to show the Radio Data StationName
-      if(showRadioDataStationName){
+      if(navigation.showStationName()){
         //And this is the first time this frequency is tuned to it
-        if(firstTimeFrequency){
-          //Retrieve the name and display it
-          stationName = &radio.radioData.getStationName()[0];
-          display.displayMenuUpdate(radio.signalStrength(), radio.getFrequency() * 10, inPressedArea, 38, radio.stereoReception(), menuArea, radio, showRadioDataStationName, stationName, curMute, clock.getDate());
-          firstTimeFrequency = false;
+        if(navigation.stationNameNeeded()){
+          //Show the cached name right away; the Radio Data capture replaces it once the name has been received. Until
+          //then, nothing waits on the Radio Data System.
+          if(!stations.find(frequency * 1000 + 0.5, cachedStation)){
+            cachedStation = stationInfo();      //Blank until received
+          }
+          stationName = cachedStation.name;
+          display.displayMenuUpdate(signalStrength, frequency * 10, navigation.isInPressedArea(), 38, stereo, navigation.getArea(), radio, navigation.showStationName(), stationName, navigation.isMuted(), date);
+          navigation.stationNameReceived();
           if(displayDebugInfo){
-            hwlib::cout << "Retrieved Station Name through the Radio Data System: " << stationName << hwlib::endl;
+            hwlib::cout << "Retrieved Station Name from the Radio Data cache: " << stationName << hwlib::endl;
           }
         } else {
           //Just print the already received stationname.
-          display.displayMenuUpdate(radio.signalStrength(), radio.getFrequency() * 10, inPressedArea, 38, radio.stereoReception(), menuArea, radio, showRadioDataStationName, (char*)&stationName[0], curMute,clock.getDate());
+          display.displayMenuUpdate(signalStrength, frequency * 10, navigation.isInPressedArea(), 38, stereo, navigation.getArea(), radio, navigation.showStationName(), stationName, navigation.isMuted(), date);
        }
       } else {
-        //If it is a preset, read stationName from memory
-        if(curTunedPreset != lastCheckedPreset){
-          memory.read(curTunedPreset * 10 + 2, 8, newData);
-          stationName = (char*)newData;
-          lastCheckedPreset = curTunedPreset;
+        //If it is a preset, take the stationName from the loaded presets
+        if(navigation.getTunedPreset() != lastCheckedPreset){
+          stationName = presets.get(navigation.getTunedPreset()).name;
+          lastCheckedPreset = navigation.getTunedPreset();
         }
         if(displayDebugInfo){
-          hwlib::cout << "Retrieved Station Name from memory: " << stationName << hwlib::endl;
+          hwlib::cout << "Retrieved Station Name from preset: " << stationName << hwlib::endl;
         }
-        display.displayMenuUpdate(radio.signalStrength(), radio.getFrequency() * 10, inPressedArea, 38, radio.stereoReception(), menuArea, radio, showRadioDataStationName, (char*)&stationName[0], curMute, clock.getDate());
+        display.displayMenuUpdate(signalStrength, frequency * 10, navigation.isInPressedArea(), 38, stereo, navigation.getArea(), radio, navigation.showStationName(), stationName, navigation.isMuted(), date);
       }
-      time = clock.getTime();
-      if(time.getMinutes() != lastMinutes){
+      if(governor.includes(refreshReason::clock)){
         lastMinutes = time.getMinutes();
         if(time.getHours() < 10){
           timeField << "\f" << "0" << time.getHours();
@@ -356,6 +454,135 @@ int main( void ){
         }
       }
     }
+  });
+
+  //The state is saved once it hasn't changed for 3 seconds; not while the band is being scanned. A moved wake-up time
+  //is saved the same way, after which the date is shown again.
+  auto resumeSave = taskFunction([&](){
+    if(radioAlarm.isSavePending()){
+      auto scope = busTraceScope(i2c_bus, "A24C256", "wakeUpSave");
+      if(radioAlarm.poll(hwlib::now_us() / 1000)){
+        display.showWakeUp(false);
+        governor.request(refreshReason::menu, hwlib::now_us() / 1000);
+        if(displayDebugInfo){
+          hwlib::cout << "Saved the moved Wake-Up" << hwlib::endl;
+        }
+      }
+    }
+    if(navigation.inBandScan() || governor.isBusy() || frequency == 0 || radioAlarm.isBusy()){
+      return;     //The volume of a wake-up or sleep timer isn't resumed
+    }
+    resumeRecord current;
+    current.frequency = frequency;
+    current.volume = radio.getVolume();
+    current.area = navigation.getArea();
+    current.muted = navigation.isMuted();
+    current.bassBoost = navigation.isBassBoosted();
+    current.showStationName = navigation.showStationName();
+    const unsigned int now = hwlib::now_us() / 1000;
+    resume.update(current, now);
+    if(resume.isPending()){
+      auto scope = busTraceScope(i2c_bus, "A24C256", "resumeSave");
+      if(resume.poll(now) && displayDebugInfo){
+        hwlib::cout << "Saved state to resume from" << hwlib::endl;
+      }
+    }
+  });
+
+  auto scheduler = taskScheduler();
+
+  //While asleep, only the input, the bus work and the clock are handled; most of the time there is nothing to run.
+  auto setPlaying = [&](const bool playing){
+    scheduler.enable(signalRefresh, playing);
+    scheduler.enable(radioDataRefresh, playing);
+    scheduler.enable(textScroll, playing);
+    scheduler.enable(bandScan, playing);
+    scheduler.enable(displayRefresh, playing);
+    scheduler.enable(resumeSave, playing);
+    oled.displayOn(playing);
+    if(playing){
+      bus.request(signalSample);
+      governor.request(refreshReason::menu, hwlib::now_us() / 1000);
+    }
+  };
+
+  //The alarm flags are only read when the DS3231 pulls its INT/SQW pin low; in between this costs no I2C traffic.
+  //The first alarm wakes the radio up, the second one is the sleep timer.
+  auto clockEvents = taskFunction([&](){
+    const uint_fast64_t now = hwlib::now_us() / 1000;
+    clockInterrupt.refresh();
+    unsigned int alarms = 0;
+    {
+      auto scope = busTraceScope(i2c_bus, "DS3231", "clockEvents");
+      if(wallClock.sample(clockInterrupt.read(), now)){
+        alarms = wallClock.takeAlarms();
+        if(displayDebugInfo && alarms != 0){
+          hwlib::cout << "Alarms triggered: " << alarms << hwlib::endl;
+        }
+      }
+    }
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "alarmClock");
+    const bool wasAsleep = radioAlarm.isAsleep();
+    if(wakeRequested){
+      wakeRequested = false;
+      radioAlarm.wake();
+    }
+    if(radioAlarm.handle(alarms, now) && radioAlarm.getState() == alarmState::wakingUp){
+      navigation.restore(navigation.getArea(), false, navigation.isBassBoosted(), navigation.showStationName());    //Unmuted
+      bus.request(signalSample);      //Tuned to the preset
+    }
+    radioAlarm.step(now);
+    if(radioAlarm.isAsleep() != wasAsleep){
+      setPlaying(!radioAlarm.isAsleep());
+      if(displayDebugInfo){
+        hwlib::cout << (radioAlarm.isAsleep() ? "Radio has gone to sleep" : "Radio has woken up") << hwlib::endl;
+      }
+    }
+  });
+
+  unsigned int reportedOverruns = 0;
+  unsigned int reportedDrops = 0;
+  auto overrunMonitor = taskFunction([&](){
+    if(displayDebugInfo && scheduler.getTotalOverruns() != reportedOverruns){
+      hwlib::cout << "Tasks have missed their deadline " << scheduler.getTotalOverruns() - reportedOverruns << " times" << hwlib::endl;
+      reportedOverruns = scheduler.getTotalOverruns();
+    }
+    if(displayDebugInfo && inputEvents.getDropped() != reportedDrops){
+      hwlib::cout << "Input events have been dropped " << inputEvents.getDropped() - reportedDrops << " times" << hwlib::endl;
+      reportedDrops = inputEvents.getDropped();
+    }
+    //Press a key in the terminal to print the statistics.
+    if(hwlib::cin.char_available()){
+      hwlib::cin.getc();
+      i2c_bus.printStatistics(hwlib::cout);
+      hwlib::cout << hwlib::endl;
+      bus.printStatistics(hwlib::cout);
+      hwlib::cout << hwlib::endl;
+      scheduler.printStatistics(hwlib::cout);
+      hwlib::cout << hwlib::endl;
+      governor.printStatistics(hwlib::cout);
+      i2c_bus.resetStatistics();
+      bus.resetStatistics();
+      scheduler.resetStatistics();
+      governor.resetStatistics();
+      reportedOverruns = 0;
+    }
+  });
+
+  scheduler.add(inputHandling, 2, 2, "Input Handling");
+  scheduler.add(displayFlush, 2, 5, "Display Flush");
+  scheduler.add(radioDataRefresh, 40, 40, "RDS Capture");
+  scheduler.add(displayRefresh, 20, 20, "Display Refresh");     //Frames are limited by the governor
+  scheduler.add(textScroll, 50, 50, "Text Scroll");
+  scheduler.add(bandScan, 20, 20, "Band Scan");
+  scheduler.add(signalRefresh, 500, 500, "RSSI Sample");
+  scheduler.add(clockRefresh, 1000, 1000, "Clock Refresh");
+  scheduler.add(clockEvents, 10, 10, "Clock Events");
+  scheduler.add(resumeSave, 500, 500, "Resume Save");
+  scheduler.add(overrunMonitor, 1000, 1000, "Overrun Monitor");
+
+  for(;;){
+    scheduler.run();
   }
 
 }
@@ -0,0 +1,397 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "menu.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has three mandatory parameters; the radio to control, the store of the presets and the band
+/// scanner. The store is a reference since presets can be added while running.
+/// When displayDebugInfo is true, everything the user does is printed in the terminal.
+menu::menu(RDA5807 & radio, presetStore & presets, bandScanner & scanner, const bool displayDebugInfo):
+	radio(radio),
+	presets(presets),
+	scanner(scanner),
+	displayDebugInfo(displayDebugInfo)
+{}
+
+/// \brief
+/// Handle Gesture
+/// \details
+/// This function handles one gesture of the rotary encoder. It returns true if the display has to be updated.
+bool menu::handle(const gestureEvent & gesture){
+	switch(gesture.type){
+		case gestureType::turnClockwise:
+			turn(true, gesture.stepSize);
+			return true;
+		case gestureType::turnCounterClockwise:
+			turn(false, gesture.stepSize);
+			return true;
+		case gestureType::click:
+			press();
+			return true;
+		case gestureType::doubleClick:
+			mute = !mute;
+			radio.setMute(mute);
+			if(displayDebugInfo){
+				hwlib::cout << hwlib::boolalpha << "Double-clicked to set Mute to: " << mute << hwlib::endl;
+			}
+			return true;
+		case gestureType::longPress:
+			if(area == 7){
+				wakeUpRequest = true;
+				if(displayDebugInfo){
+					hwlib::cout << "Long-pressed to set or clear the Wake-Up" << hwlib::endl;
+				}
+			} else {
+				presetRequest = true;
+				if(displayDebugInfo){
+					hwlib::cout << "Long-pressed to save the tuned frequency as preset" << hwlib::endl;
+				}
+			}
+			return false;
+		case gestureType::pressTurnClockwise:
+			if(area == 7){
+				moveWakeUp(true, gesture.stepSize);
+			} else {
+				changeVolume(true);
+			}
+			return true;
+		case gestureType::pressTurnCounterClockwise:
+			if(area == 7){
+				moveWakeUp(false, gesture.stepSize);
+			} else {
+				changeVolume(false);
+			}
+			return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Turn
+/// \details
+/// This function handles one step of the encoder. In a pressed area the radio is tuned, otherwise the next or
+/// previous Menu Area is selected. The step size only applies to Manual Search; it multiplies the 0.1MHz step.
+void menu::turn(const bool clockwise, const unsigned int stepSize){
+	if(inPressedArea){
+		if(displayDebugInfo){
+			hwlib::cout << (clockwise ? "Turned Clockwise " : "Turned Counter Clockwise ");
+		}
+		if(area == 0){    //Auto search
+			if(displayDebugInfo){
+				hwlib::cout << "to perform Auto Search " << (clockwise ? "Up" : "Down") << hwlib::endl;
+			}
+			radio.seekChannel(clockwise);
+			newFrequency = true;
+			showRadioDataStationName = true;
+		} else if(area == 1){  //Manual Search
+			showRadioDataStationName = false;
+			newFrequency = true;
+			auto frequency = radio.getFrequency() + (clockwise ? 0.1 * stepSize + 0.02 : -0.1 * stepSize);      //0.02 extra to compensate for autotune
+			hwlib::wait_ms(30);
+			radio.setFrequency(frequency);
+			if(displayDebugInfo){
+				hwlib::cout << "to perform Manual Search " << (clockwise ? "Up" : "Down") << " to " << int(frequency * 10) << hwlib::endl;
+			}
+		} else if(area == 2){  //Preset select
+			const int amountOfPresets = presets.getAmount();
+			if(amountOfPresets == 0){
+				return;
+			}
+			showRadioDataStationName = false;
+			if(clockwise){
+				tunedPreset++;
+				if(tunedPreset >= amountOfPresets){
+					tunedPreset = 0;
+				}
+			} else {
+				tunedPreset--;
+				if(tunedPreset < 0){
+					tunedPreset = amountOfPresets - 1;
+				}
+			}
+			hwlib::wait_ms(30);
+			radio.setFrequency(presets.get(tunedPreset).getFrequency());
+			if(displayDebugInfo){
+				hwlib::cout << "to select " << (clockwise ? "next" : "previous") << " preset: " << int(presets.get(tunedPreset).frequency / 100) << hwlib::endl;
+			}
+		} else if(area == 8){  //Band Scan
+			if(scanner.isScanning()){
+				return;		//The radio is busy scanning
+			}
+			cursor = scanner.nextPeak(cursor, clockwise);
+			showRadioDataStationName = true;
+			newFrequency = true;
+			radio.setFrequency(scanner.getFrequency(cursor) / 10.0 + 0.02);		//0.02 extra to compensate for autotune
+			if(displayDebugInfo){
+				hwlib::cout << "to tune to the " << (clockwise ? "next" : "previous") << " peak: " << scanner.getFrequency(cursor) << hwlib::endl;
+			}
+		}
+		tuned = true;
+	} else {
+		if(clockwise){
+			area = (area == 8) ? 0 : area + 1;
+		} else {
+			area = (area == 0) ? 8 : area - 1;
+		}
+		if(displayDebugInfo){
+			hwlib::cout << (clockwise ? "Turned Clockwise" : "Turned Counter Clockwise") << " to select Menu Area " << area << hwlib::endl;
+		}
+	}
+}
+
+/// \brief
+/// Press
+/// \details
+/// This function handles a press of the button; entering or leaving Area 0 to 2, toggling the setting of Area 3 to 6 or
+/// requesting the sleep timer to be started or stopped in Area 7.
+void menu::press(){
+	if(area < 3){
+		inPressedArea = !inPressedArea;
+		if(displayDebugInfo){
+			if(inPressedArea){
+				hwlib::cout << "Button has been pressed to change settings in Menu Area " << area << hwlib::endl;
+			} else {
+				hwlib::cout << "Button has been pressed to stop changing settings in Menu Area " << area << hwlib::endl;
+			}
+		}
+	} else if(area == 3){
+		bassBoost = !bassBoost;
+		hwlib::wait_ms(30);
+		radio.setBassBoost(bassBoost);
+		if(displayDebugInfo){
+			hwlib::cout << hwlib::boolalpha << "Pressed button to set Bass Boost to: " << bassBoost << hwlib::endl;
+		}
+	} else if(area == 4){
+		mute = !mute;
+		radio.setMute(mute);
+		if(displayDebugInfo){
+			hwlib::cout << hwlib::boolalpha << "Pressed button to set Mute to: " << mute << hwlib::endl;
+		}
+	} else if(area == 5){
+		auto radioData = radio.radioDataEnabled();
+		hwlib::wait_ms(30);
+		radio.enableRadioData(!radioData);
+		if(displayDebugInfo){
+			hwlib::cout << hwlib::boolalpha << "Pressed button to set Radio Data Decoding to: " << !radioData << hwlib::endl;
+		}
+	} else if(area == 6){
+		showRadioDataStationName = !showRadioDataStationName;
+		if(displayDebugInfo){
+			hwlib::cout << hwlib::boolalpha << "Pressed button to set Radio Data Station Name to: " << showRadioDataStationName << hwlib::endl;
+		}
+	} else if(area == 7){
+		sleepRequest = true;
+		if(displayDebugInfo){
+			hwlib::cout << "Pressed button to start or stop the Sleep Timer" << hwlib::endl;
+		}
+	} else if(area == 8){
+		inPressedArea = !inPressedArea;
+		if(inPressedArea){
+			scanner.start();
+		} else {
+			scanner.stop();
+		}
+		if(displayDebugInfo){
+			hwlib::cout << "Button has been pressed to " << (inPressedArea ? "start" : "leave") << " the Band Scan" << hwlib::endl;
+		}
+	}
+}
+
+/// \brief
+/// Change Volume
+/// \details
+/// This function turns the volume one step up or down; between 0 and 15.
+void menu::changeVolume(const bool up){
+	auto volume = radio.getVolume();
+	if(up && volume < 15){
+		volume++;
+	} else if(!up && volume > 0){
+		volume--;
+	}
+	radio.setVolume(volume);
+	if(displayDebugInfo){
+		hwlib::cout << "Turned while pressing to set Volume to: " << volume << hwlib::endl;
+	}
+}
+
+/// \brief
+/// Move Wake-Up
+/// \details
+/// This function requests the wake-up time to be moved 5 minutes later or earlier per step; the step size grows when
+/// the encoder is spun fast, so a whole day can be crossed quickly.
+void menu::moveWakeUp(const bool later, const unsigned int stepSize){
+	const int minutes = 5 * ((stepSize > 0) ? stepSize : 1);
+	wakeUpChange += later ? minutes : -minutes;
+	if(displayDebugInfo){
+		hwlib::cout << "Turned while pressing to move the Wake-Up " << (later ? "later" : "earlier") << " by " << minutes << " minutes" << hwlib::endl;
+	}
+}
+
+/// \brief
+/// Get Menu Area
+/// \details
+/// This function returns the selected Menu Area; 0 to 8.
+unsigned int menu::getArea(){
+	return area;
+}
+
+/// \brief
+/// Is In Pressed Area
+/// \details
+/// This function returns true if the button has been pressed to change the settings of Area 0, 1, 2 or 8.
+bool menu::isInPressedArea(){
+	return inPressedArea;
+}
+
+/// \brief
+/// Uses Double-Click
+/// \details
+/// This function returns true if a double-click has a meaning in the current state; not in Area 4, where a click
+/// toggles Mute already, and not while Area 0, 1, 2 or 8 has been entered. Otherwise a click can be handled as soon
+/// as the button is released; see gestureRecognizer::useDoubleClick().
+bool menu::usesDoubleClick(){
+	return !inPressedArea && area != 4;
+}
+
+/// \brief
+/// Has Tuned
+/// \details
+/// This function returns true once after the radio has been tuned, so the new frequency can be read.
+bool menu::hasTuned(){
+	if(tuned){
+		tuned = false;
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Preset Requested
+/// \details
+/// This function returns true once after a long-press outside Area 7; the tuned frequency should then be saved as a
+/// preset.
+bool menu::presetRequested(){
+	if(presetRequest){
+		presetRequest = false;
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Sleep Timer Requested
+/// \details
+/// This function returns true once after a press in Area 7; the sleep timer should then be started, or stopped when
+/// it is running.
+bool menu::sleepTimerRequested(){
+	if(sleepRequest){
+		sleepRequest = false;
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Wake-Up Requested
+/// \details
+/// This function returns true once after a long-press in Area 7; the wake-up should then be enabled with the tuned
+/// preset and volume, or be disabled when it is enabled.
+bool menu::wakeUpRequested(){
+	if(wakeUpRequest){
+		wakeUpRequest = false;
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Get Wake-Up Change
+/// \details
+/// This function returns the amount of minutes the wake-up time has been moved by turning while pressing in Area 7
+/// since the last call; negative when it has been moved earlier. The wake-up should then be moved and enabled.
+int menu::getWakeUpChange(){
+	const int change = wakeUpChange;
+	wakeUpChange = 0;
+	return change;
+}
+
+/// \brief
+/// Station Name Needed
+/// \details
+/// This function returns true if a new frequency has been tuned to and its Radio Data Station Name should be received.
+bool menu::stationNameNeeded(){
+	return showRadioDataStationName && newFrequency;
+}
+
+/// \brief
+/// Station Name Received
+/// \details
+/// This function has to be called after the Station Name of the new frequency has been received.
+void menu::stationNameReceived(){
+	newFrequency = false;
+}
+
+/// \brief
+/// Show Station Name
+/// \details
+/// This function returns true if the Radio Data Station Name should be shown, or false when the name of the preset should be shown.
+bool menu::showStationName(){
+	return showRadioDataStationName;
+}
+
+/// \brief
+/// Is Muted
+/// \details
+/// This function returns true if the radio has been muted through the menu.
+bool menu::isMuted(){
+	return mute;
+}
+
+/// \brief
+/// Is Bass Boosted
+/// \details
+/// This function returns true if Bass Boost has been enabled through the menu.
+bool menu::isBassBoosted(){
+	return bassBoost;
+}
+
+/// \brief
+/// Get Tuned Preset
+/// \details
+/// This function returns the index of the preset that has been selected last.
+int menu::getTunedPreset(){
+	return tunedPreset;
+}
+
+/// \brief
+/// In Band Scan
+/// \details
+/// This function returns true if the Band Scan has been entered; its spectrum should then be shown.
+bool menu::inBandScan(){
+	return area == 8 && inPressedArea;
+}
+
+/// \brief
+/// Get Cursor
+/// \details
+/// This function returns the column of the spectrum the cursor of the Band Scan is at.
+unsigned int menu::getCursor(){
+	return cursor;
+}
+
+/// \brief
+/// Restore
+/// \details
+/// This function puts the menu back in the given state; the area, mute, bass boost and whether the Radio Data station
+/// name is shown. The radio is expected to have been set accordingly already. Areas that don't exist are ignored.
+void menu::restore(const unsigned int restoredArea, const bool muted, const bool bassBoosted, const bool showStationName){
+	if(restoredArea <= 7){
+		area = restoredArea;		//The band scan (8) isn't resumed
+	}
+	mute = muted;
+	bassBoost = bassBoosted;
+	showRadioDataStationName = showStationName;
+}
@@ -0,0 +1,90 @@
+/// @file
+
+#ifndef __MENU_HPP
+#define __MENU_HPP
+
+#include "RDA5807.hpp"
+#include "gestureRecognizer.hpp"
+#include "bandScanner.hpp"
+#include "presetStore.hpp"
+
+/// \brief
+/// Menu
+/// \details
+/// This is the state machine behind the menu of the Portable Radio. It consumes the gestures of the
+/// rotary encoder one at a time and issues the corresponding radio commands. Turning the encoder selects
+/// one of the 9 Menu Areas; clicking in Area 0 (Auto Search), 1 (Manual Search) or 2 (Presets)
+/// enters that area, after which turning seeks, tunes or selects the next preset. Clicking in
+/// Area 3 to 6 toggles Bass Boost, Mute, Radio Data Decoding and showing the Radio Data Station Name.
+/// Clicking in Area 7 (the date) requests the sleep timer to be started or stopped; a long-press there requests the
+/// wake-up to be enabled or disabled and turning while pressing moves the wake-up time 5 minutes per step.
+/// Clicking in Area 8 (Band Scan) starts a scan of the band; once done, turning moves the cursor to the
+/// next or previous peak and tunes to it. Clicking again leaves the scan.
+/// Anywhere else in the menu, turning while pressing changes the volume. Everywhere, a long-press (outside Area 7)
+/// requests the tuned frequency to be saved as a preset. A double-click toggles Mute, except in Area 4 (where a click
+/// already does) and while an area has been entered; there, clicks don't have to wait for a possible second click
+/// (see usesDoubleClick()).
+///
+/// Since the events are queued, steps made while the radio is tuning are handled afterwards instead of lost.
+/// When the encoder is spun fast, Manual Search takes steps of up to 1MHz instead of 0.1MHz.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto navigation = menu(radio, presets, scanner);
+/// gestureEvent gesture;
+/// while(gestures.poll(gesture, sampler.getSamples())){
+/// 	if(navigation.handle(gesture)){
+/// 		//Update display
+/// 	}
+/// }
+/// ~~~~~~~~~~~~~~~
+class menu{
+	private:
+		RDA5807 & radio;
+		presetStore & presets;
+		bandScanner & scanner;
+		const bool displayDebugInfo;
+
+		unsigned int area = 0;			//0 for autoSearch, 1 for manualSearch, 2 for presets, etc.
+		bool inPressedArea = false;
+		bool newFrequency = false;
+		bool tuned = false;
+		bool presetRequest = false;
+		bool sleepRequest = false;
+		bool wakeUpRequest = false;
+		bool bassBoost = false;
+		bool showRadioDataStationName = true;
+		bool mute = false;
+		int tunedPreset = 0;
+		int wakeUpChange = 0;			//Minutes the wake-up time has to be moved
+		unsigned int cursor = 0;
+
+		void turn(const bool clockwise, const unsigned int stepSize);
+		void press();
+		void changeVolume(const bool up);
+		void moveWakeUp(const bool later, const unsigned int stepSize);
+	public:
+		menu(RDA5807 & radio, presetStore & presets, bandScanner & scanner, const bool displayDebugInfo = false);
+
+		bool handle(const gestureEvent & gesture);
+
+		unsigned int getArea();
+		bool isInPressedArea();
+		bool usesDoubleClick();
+		bool hasTuned();
+		bool presetRequested();
+		bool sleepTimerRequested();
+		bool wakeUpRequested();
+		int getWakeUpChange();
+		bool stationNameNeeded();
+		void stationNameReceived();
+		bool showStationName();
+		bool isMuted();
+		bool isBassBoosted();
+		int getTunedPreset();
+		bool inBandScan();
+		unsigned int getCursor();
+
+		void restore(const unsigned int restoredArea, const bool muted, const bool bassBoosted, const bool showStationName);
+};
+
+#endif //__MENU_HPP
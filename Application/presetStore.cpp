@@ -0,0 +1,206 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "presetStore.hpp"
+#include "crc8.hpp"
+#include "eepromStream.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the frequency (in MHz) and the name. The name is padded with spaces
+/// up to 8 characters. The Program Identification, volume and flags default to 0.
+preset::preset(const float frequency, const char * givenName, const uint16_t programIdentification, const uint8_t volume, const uint8_t flags):
+	frequency(frequency * 1000 + 0.5),
+	programIdentification(programIdentification),
+	volume(volume),
+	flags(flags)
+{
+	bool ended = false;
+	for(unsigned int i = 0; i < 8; i++){
+		ended |= givenName[i] == '\0';
+		name[i] = ended ? ' ' : givenName[i];
+	}
+	name[8] = '\0';
+}
+
+/// \brief
+/// Get Frequency
+/// \details
+/// This function returns the frequency in MHz, as used by the radio.
+float preset::getFrequency() const {
+	return frequency / 1000.0;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the EEPROM. The location of the table defaults to 0. Nothing is read
+/// until load() is called.
+presetStore::presetStore(A24C256 & memory, const unsigned int base):
+	memory(memory),
+	base(base)
+{}
+
+/// \brief
+/// Encode Record
+/// \details
+/// This function packs the given preset in a record of 16 bytes; the last byte is the CRC of the others.
+void presetStore::encode(const preset & given, uint8_t record[recordSize]){
+	record[0] = given.frequency >> 16;
+	record[1] = given.frequency >> 8;
+	record[2] = given.frequency;
+	record[3] = given.programIdentification >> 8;
+	record[4] = given.programIdentification;
+	for(unsigned int i = 0; i < 8; i++){
+		record[5 + i] = given.name[i];
+	}
+	record[13] = given.volume;
+	record[14] = given.flags;
+	record[15] = crc8(record, recordSize - 1);
+}
+
+/// \brief
+/// Decode Record
+/// \details
+/// This function unpacks the given record. It returns false if the CRC doesn't match.
+bool presetStore::decode(const uint8_t record[recordSize], preset & result){
+	if(crc8(record, recordSize - 1) != record[15]){
+		return false;
+	}
+	result.frequency = (uint32_t(record[0]) << 16) | (uint32_t(record[1]) << 8) | record[2];
+	result.programIdentification = (uint16_t(record[3]) << 8) | record[4];
+	for(unsigned int i = 0; i < 8; i++){
+		result.name[i] = record[5 + i];
+	}
+	result.name[8] = '\0';
+	result.volume = record[13];
+	result.flags = record[14];
+	return true;
+}
+
+/// \brief
+/// Write Header
+/// \details
+/// This function writes the header with the current amount of presets with one page write.
+void presetStore::writeHeader(){
+	uint8_t header[headerSize] = {'P', 'T', version, recordSize, maxPresets >> 8, maxPresets & 0xFF, uint8_t(amount >> 8), uint8_t(amount & 0xFF)};
+	for(unsigned int i = 8; i < headerSize - 1; i++){
+		header[i] = 0xFF;
+	}
+	header[headerSize - 1] = crc8(header, headerSize - 1);
+	memory.write(base, header, headerSize);
+}
+
+/// \brief
+/// Write Record
+/// \details
+/// This function writes the preset at the given index to its record with one page write.
+void presetStore::writeRecord(const unsigned int index){
+	uint8_t record[recordSize];
+	encode(presets[index], record);
+	memory.write(base + headerSize + index * recordSize, record, recordSize);
+}
+
+/// \brief
+/// Load Table
+/// \details
+/// This function reads the header and, when it is valid, all records in one sequential pass through an eepromInputStream;
+/// the location is only sent once and the records are decoded one at a time, so no buffer of the size of the table is
+/// needed. Records of which the CRC doesn't match are left out and counted; the others are written again without them.
+/// It returns false if there is no valid table of this version; the store is then empty.
+bool presetStore::load(){
+	amount = 0;
+	corrupted = 0;
+	auto stream = eepromInputStream(memory, base);
+	uint8_t header[headerSize];
+	stream.read(header, headerSize);
+	const unsigned int capacity = (header[4] << 8) | header[5];
+	const unsigned int stored = (header[6] << 8) | header[7];
+	if(header[0] != 'P' || header[1] != 'T' || header[2] != version || header[3] != recordSize || crc8(header, headerSize - 1) != header[headerSize - 1] || capacity != maxPresets || stored > maxPresets){
+		return false;
+	}
+	uint8_t record[recordSize];
+	for(unsigned int i = 0; i < stored; i++){
+		stream.read(record, recordSize);
+		if(decode(record, presets[amount])){
+			amount++;
+		} else {
+			corrupted++;
+		}
+	}
+	if(corrupted > 0){
+		for(unsigned int i = 0; i < amount; i++){
+			writeRecord(i);
+		}
+		writeHeader();
+	}
+	return true;
+}
+
+/// \brief
+/// Format Table
+/// \details
+/// This function writes an empty table; all presets are removed.
+void presetStore::format(){
+	amount = 0;
+	corrupted = 0;
+	writeHeader();
+}
+
+/// \brief
+/// Add Preset
+/// \details
+/// This function adds the given preset; its record is written first, the amount in the header last. That way a power
+/// failure in between leaves the table as it was. Returns false when the table is full.
+bool presetStore::add(const preset & given){
+	if(amount >= maxPresets){
+		return false;
+	}
+	presets[amount] = given;
+	writeRecord(amount);
+	amount++;
+	writeHeader();
+	return true;
+}
+
+/// \brief
+/// Change Preset
+/// \details
+/// This function replaces the preset at the given index. Returns false when there is no preset at that index.
+bool presetStore::set(const unsigned int index, const preset & given){
+	if(index >= amount){
+		return false;
+	}
+	presets[index] = given;
+	writeRecord(index);
+	return true;
+}
+
+/// \brief
+/// Get Preset
+/// \details
+/// This function returns the preset at the given index from RAM. When there is no preset at that index, an empty preset
+/// (frequency 0) is returned.
+const preset & presetStore::get(const unsigned int index){
+	static const preset empty;
+	return (index < amount) ? presets[index] : empty;
+}
+
+/// \brief
+/// Get Amount of Presets
+/// \details
+/// This function returns the amount of presets in the table.
+unsigned int presetStore::getAmount(){
+	return amount;
+}
+
+/// \brief
+/// Get Amount of Corrupted Records
+/// \details
+/// This function returns how many records have been left out by the last load() because their CRC didn't match.
+unsigned int presetStore::getCorrupted(){
+	return corrupted;
+}
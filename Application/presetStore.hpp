@@ -0,0 +1,95 @@
+/// @file
+
+#ifndef __PRESET_STORE_HPP
+#define __PRESET_STORE_HPP
+
+#include "A24C256.hpp"
+
+/// \brief
+/// Preset
+/// \details
+/// This struct contains everything that is saved of one preset; the frequency (in kHz), the Program Identification
+/// and Program Service name (8 characters) of its Radio Data, the volume and flags (see presetFlags).
+struct preset{
+	uint32_t frequency = 0;
+	uint16_t programIdentification = 0;
+	char name[9] = {"        "};
+	uint8_t volume = 0;
+	uint8_t flags = 0;
+
+	preset() {}
+	preset(const float frequency, const char * givenName, const uint16_t programIdentification = 0, const uint8_t volume = 0, const uint8_t flags = 0);
+	float getFrequency() const;
+};
+
+/// \brief
+/// Preset Flags
+/// \details
+/// These are the bits of the flags of a preset.
+namespace presetFlags{
+	constexpr uint8_t bassBoost = 0x01;
+	constexpr uint8_t mono = 0x02;
+	constexpr uint8_t radioData = 0x04;
+}
+
+/// \brief
+/// Preset Store
+/// \details
+/// This is a class that keeps the presets in a versioned table in a 24CXXX EEPROM. The table starts with a header of 16
+/// bytes (magic "PT", version, record size, capacity, amount of presets and a CRC), followed by the records. Every record
+/// is 16 bytes; the frequency in kHz (3 bytes), Program Identification (2 bytes), Program Service name (8 bytes), volume,
+/// flags and a CRC-8 of the other 15 bytes. Since 16 bytes divide a page of 64 bytes, a record never crosses a page.
+///
+/// load() reads the header and all records in one sequential pass and keeps the presets in RAM; getting a preset never
+/// touches the bus. A record of which the CRC doesn't match is left out. Up to 240 presets fit in the first
+/// 4KB of the chip.
+///
+///	All supported operations are:
+///		- Load Table
+///		- Format Table
+///		- Add Preset
+///		- Change Preset
+///		- Get Preset (from RAM)
+///		- Get Amount of Presets
+///		- Get Amount of Corrupted Records
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto memory = A24C256(i2c_bus);
+/// auto presets = presetStore(memory);
+/// if(!presets.load()){
+/// 	presets.format();
+/// }
+/// presets.add(preset(100.7, "Q-Music"));
+/// hwlib::cout << presets.get(0).name << ": " << presets.get(0).frequency << "kHz" << hwlib::endl;
+/// ~~~~~~~~~~~~~~~
+class presetStore{
+	public:
+		static constexpr unsigned int maxPresets = 240;
+		static constexpr unsigned int headerSize = 16;
+		static constexpr unsigned int recordSize = 16;
+		static constexpr uint8_t version = 1;
+	private:
+		A24C256 & memory;
+		const unsigned int base;
+		preset presets[maxPresets];
+		unsigned int amount = 0;
+		unsigned int corrupted = 0;
+
+		void writeHeader();
+		void writeRecord(const unsigned int index);
+		static void encode(const preset & given, uint8_t record[recordSize]);
+		static bool decode(const uint8_t record[recordSize], preset & result);
+	public:
+		presetStore(A24C256 & memory, const unsigned int base = 0);
+
+		bool load();
+		void format();
+		bool add(const preset & given);
+		bool set(const unsigned int index, const preset & given);
+
+		const preset & get(const unsigned int index);
+		unsigned int getAmount();
+		unsigned int getCorrupted();
+};
+
+#endif //__PRESET_STORE_HPP
@@ -0,0 +1,297 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "radioDataCache.hpp"
+#include "crc8.hpp"
+#include "eepromStream.hpp"
+
+/// \brief
+/// Set Name
+/// \details
+/// This function copies the given Program Service name, padded with spaces up to 8 characters.
+void stationInfo::setName(const char * givenName){
+	bool ended = false;
+	for(unsigned int i = 0; i < 8; i++){
+		ended |= givenName[i] == '\0';
+		name[i] = ended ? ' ' : givenName[i];
+	}
+	name[8] = '\0';
+}
+
+/// \brief
+/// Compare Station Info
+/// \details
+/// These operators return wether or not all Radio Data of both stations is equal.
+bool stationInfo::operator==(const stationInfo & other) const {
+	if(frequency != other.frequency || programIdentification != other.programIdentification || programType != other.programType
+		|| amountOfAlternatives != other.amountOfAlternatives){
+		return false;
+	}
+	for(unsigned int i = 0; i < 8; i++){
+		if(name[i] != other.name[i]){
+			return false;
+		}
+	}
+	for(unsigned int i = 0; i < amountOfAlternatives; i++){
+		if(alternatives[i] != other.alternatives[i]){
+			return false;
+		}
+	}
+	return true;
+}
+
+bool stationInfo::operator!=(const stationInfo & other) const {
+	return !(*this == other);
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the EEPROM. The cache starts at 8192 by default, behind the presets
+/// and the settings, and has 64 slots (2KB). A record is only written after the same Radio Data has been observed
+/// 25 times in a row; with a capture every 40ms that is one second. Nothing is read until load() is called.
+radioDataCache::radioDataCache(A24C256 & memory, const unsigned int base, const unsigned int slots, const unsigned int requiredObservations):
+	memory(memory),
+	base(base),
+	slots((slots > 0 && slots <= maxSlots) ? slots : maxSlots),
+	requiredObservations((requiredObservations > 0) ? requiredObservations : 1)
+{}
+
+/// \brief
+/// Encode Record
+/// \details
+/// This function fills the given record with the given station and sequence number. Alternative Frequencies are
+/// stored as RDS codes; (frequency - 87.5MHz) / 100kHz. Unused bytes are 0xFF.
+void radioDataCache::encode(const stationInfo & info, const uint16_t sequence, uint8_t record[recordSize]){
+	for(unsigned int i = 0; i < recordSize; i++){
+		record[i] = 0xFF;
+	}
+	record[0] = marker;
+	record[1] = (info.frequency >> 16) & 0xFF;
+	record[2] = (info.frequency >> 8) & 0xFF;
+	record[3] = info.frequency & 0xFF;
+	record[4] = info.programIdentification >> 8;
+	record[5] = info.programIdentification & 0xFF;
+	for(unsigned int i = 0; i < 8; i++){
+		record[6 + i] = info.name[i];
+	}
+	record[14] = info.programType;
+	record[15] = sequence >> 8;
+	record[16] = sequence & 0xFF;
+	const unsigned int amount = (info.amountOfAlternatives <= stationInfo::maxAlternatives) ? info.amountOfAlternatives : stationInfo::maxAlternatives;
+	record[17] = amount;
+	for(unsigned int i = 0; i < amount; i++){
+		record[18 + i] = (info.alternatives[i] - 87500) / 100;
+	}
+	record[recordSize - 1] = crc8(record, recordSize - 1);
+}
+
+/// \brief
+/// Decode Record
+/// \details
+/// This function fills the given station and sequence number with the content of the given record. It returns false
+/// if the record is empty or corrupted.
+bool radioDataCache::decode(const uint8_t record[recordSize], stationInfo & result, uint16_t & sequence){
+	if(record[0] != marker || record[17] > stationInfo::maxAlternatives || crc8(record, recordSize - 1) != record[recordSize - 1]){
+		return false;
+	}
+	result.frequency = (uint32_t(record[1]) << 16) | (uint32_t(record[2]) << 8) | record[3];
+	result.programIdentification = (record[4] << 8) | record[5];
+	for(unsigned int i = 0; i < 8; i++){
+		result.name[i] = record[6 + i];
+	}
+	result.name[8] = '\0';
+	result.programType = record[14];
+	sequence = (record[15] << 8) | record[16];
+	result.amountOfAlternatives = record[17];
+	for(unsigned int i = 0; i < result.amountOfAlternatives; i++){
+		result.alternatives[i] = 87500 + record[18 + i] * 100;
+	}
+	return true;
+}
+
+/// \brief
+/// Load Index
+/// \details
+/// This function reads all slots with one sequential read and builds the index in RAM. Corrupted records are counted
+/// and their slots are reused. It returns the amount of stations in the cache.
+unsigned int radioDataCache::load(){
+	auto input = eepromInputStream(memory, base);
+	amount = 0;
+	corrupted = 0;
+	sequence = 0;
+	for(unsigned int slot = 0; slot < slots; slot++){
+		uint8_t record[recordSize];
+		input.read(record, recordSize);
+		stationInfo info;
+		uint16_t recordSequence = 0;
+		index[slot] = slotIndex();
+		if(decode(record, info, recordSequence)){
+			index[slot].frequency = info.frequency;
+			index[slot].programIdentification = info.programIdentification;
+			index[slot].sequence = recordSequence;
+			index[slot].used = true;
+			if(recordSequence > sequence){
+				sequence = recordSequence;
+			}
+			amount++;
+		} else if(record[0] != 0xFF){
+			corrupted++;
+		}
+	}
+	return amount;
+}
+
+/// \brief
+/// Format
+/// \details
+/// This function empties all slots; only the marker of every record is overwritten.
+void radioDataCache::format(){
+	for(unsigned int slot = 0; slot < slots; slot++){
+		memory.write(base + slot * recordSize, uint8_t(0xFF));
+		index[slot] = slotIndex();
+	}
+	amount = 0;
+	corrupted = 0;
+	sequence = 0;
+}
+
+/// \brief
+/// Find Slot
+/// \details
+/// This function returns the slot that contains the given station, or -1 when it isn't cached. When the Program
+/// Identification is 0, the station that has been written last on the given frequency is returned.
+int radioDataCache::findSlot(const uint32_t frequency, const uint16_t programIdentification){
+	int found = -1;
+	for(unsigned int slot = 0; slot < slots; slot++){
+		if(index[slot].used && index[slot].frequency == frequency
+			&& (programIdentification == 0 || index[slot].programIdentification == programIdentification)
+			&& (found < 0 || index[slot].sequence > index[found].sequence)){
+			found = slot;
+		}
+	}
+	return found;
+}
+
+/// \brief
+/// Choose Slot
+/// \details
+/// This function returns the slot a new station is written to; the first free one, or the one that has been written
+/// longest ago.
+unsigned int radioDataCache::chooseSlot(){
+	unsigned int oldest = 0;
+	for(unsigned int slot = 0; slot < slots; slot++){
+		if(!index[slot].used){
+			return slot;
+		}
+		if(index[slot].sequence < index[oldest].sequence){
+			oldest = slot;
+		}
+	}
+	return oldest;
+}
+
+/// \brief
+/// Read Slot
+/// \details
+/// This function reads the record in the given slot with one multi-byte read. It returns false if it is corrupted.
+bool radioDataCache::readSlot(const unsigned int slot, stationInfo & result){
+	uint8_t record[recordSize];
+	memory.read(base + slot * recordSize, recordSize, record);
+	uint16_t recordSequence = 0;
+	return decode(record, result, recordSequence);
+}
+
+/// \brief
+/// Write Slot
+/// \details
+/// This function writes the given station with the next sequence number to the given slot and updates the index.
+void radioDataCache::writeSlot(const unsigned int slot, const stationInfo & info){
+	uint8_t record[recordSize];
+	encode(info, ++sequence, record);
+	memory.write(base + slot * recordSize, record, recordSize);
+	if(!index[slot].used){
+		amount++;
+	}
+	index[slot].frequency = info.frequency;
+	index[slot].programIdentification = info.programIdentification;
+	index[slot].sequence = sequence;
+	index[slot].used = true;
+	writtenRecords++;
+}
+
+/// \brief
+/// Find Station
+/// \details
+/// This function fills the given station with the cached Radio Data for the given frequency (in kHz) and returns true
+/// if it has been found. Right after tuning the Program Identification isn't known yet; then it is left 0 and the
+/// station that has been heard last on that frequency is returned. Only the index is searched; one record is read.
+bool radioDataCache::find(const uint32_t frequency, stationInfo & result, const uint16_t programIdentification){
+	const int slot = findSlot(frequency, programIdentification);
+	return slot >= 0 && readSlot(slot, result);
+}
+
+/// \brief
+/// Observe Decoded Radio Data
+/// \details
+/// This function is given the decoded Radio Data every time it has been captured; it only compares it in RAM. Data
+/// without Program Identification or Program Service name is ignored. Once the same data has been observed the
+/// required amount of times in a row, the stored record is read and, only when it differs, written. It returns true
+/// when a record has been written.
+bool radioDataCache::observe(const stationInfo & decoded){
+	bool named = false;
+	for(unsigned int i = 0; i < 8; i++){
+		named |= decoded.name[i] != ' ';
+	}
+	if(decoded.frequency == 0 || decoded.programIdentification == 0 || !named){
+		observations = 0;
+		return false;
+	}
+	if(decoded != candidate){
+		candidate = decoded;
+		observations = 1;
+	} else if(observations < requiredObservations){
+		observations++;
+	} else {
+		return false;		//Stable and already handled
+	}
+	if(observations < requiredObservations){
+		return false;
+	}
+	int slot = findSlot(candidate.frequency, candidate.programIdentification);
+	stationInfo stored;
+	if(slot >= 0 && readSlot(slot, stored) && stored == candidate){
+		return false;
+	}
+	if(slot < 0){
+		slot = chooseSlot();
+	}
+	writeSlot(slot, candidate);
+	return true;
+}
+
+/// \brief
+/// Get Amount of Stations
+/// \details
+/// This function returns the amount of stations in the cache.
+unsigned int radioDataCache::getAmount(){
+	return amount;
+}
+
+/// \brief
+/// Get Amount of Corrupted Records
+/// \details
+/// This function returns the amount of records that have been left out by load() because their CRC didn't match.
+unsigned int radioDataCache::getCorrupted(){
+	return corrupted;
+}
+
+/// \brief
+/// Get Amount of Written Records
+/// \details
+/// This function returns the amount of records that have been written since construction.
+unsigned int radioDataCache::getWrittenRecords(){
+	return writtenRecords;
+}
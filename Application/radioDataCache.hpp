@@ -0,0 +1,107 @@
+/// @file
+
+#ifndef __RADIO_DATA_CACHE_HPP
+#define __RADIO_DATA_CACHE_HPP
+
+#include "A24C256.hpp"
+
+/// \brief
+/// Station Info
+/// \details
+/// This struct contains the Radio Data of one station that is worth remembering; the frequency (in kHz) it was received
+/// on, the Program Identification, the Program Service name (8 characters), the Program Type and the Alternative
+/// Frequencies (in kHz, sorted).
+struct stationInfo{
+	static constexpr unsigned int maxAlternatives = 13;
+	uint32_t frequency = 0;
+	uint16_t programIdentification = 0;
+	char name[9] = {"        "};
+	uint8_t programType = 0;
+	uint8_t amountOfAlternatives = 0;
+	uint32_t alternatives[maxAlternatives] = {};
+
+	void setName(const char * givenName);
+	bool operator==(const stationInfo & other) const;
+	bool operator!=(const stationInfo & other) const;
+};
+
+/// \brief
+/// Radio Data Cache
+/// \details
+/// This is a class that remembers the Radio Data of the stations that have been listened to in a 24CXXX EEPROM, keyed by
+/// frequency and Program Identification. After tuning, the Program Service name can be shown right away instead of after
+/// the seconds it takes to receive it.
+///
+/// Every station takes one record of 32 bytes, so a record never crosses a page; a marker, the frequency (3 bytes),
+/// the Program Identification (2 bytes), the Program Service name (8 bytes), the Program Type, a sequence number (2
+/// bytes), the amount of Alternative Frequencies, up to 13 Alternative Frequencies (one byte each, as coded by RDS) and
+/// a CRC-8 of the other 31 bytes. load() reads all records with one sequential read and keeps an index (frequency,
+/// Program Identification and sequence number per slot) in RAM; find() only reads the one record it needs.
+///
+/// observe() is given the decoded Radio Data every time it has been captured. Only when the same values have been
+/// observed a number of times in a row, and they differ from what is stored, the record is written. A new station
+/// takes a free slot or the slot that has been written longest ago.
+///
+///	All supported operations are:
+///		- Load Index
+///		- Format
+///		- Find Station (by frequency, optionally by Program Identification)
+///		- Observe Decoded Radio Data
+///		- Get Amount of Stations
+///		- Get Amount of Written and Corrupted Records
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto memory = A24C256(i2c_bus);
+/// auto stations = radioDataCache(memory);
+/// stations.load();
+/// stationInfo cached;
+/// if(stations.find(100700, cached)){
+/// 	hwlib::cout << cached.name << hwlib::endl;		//Known before any Radio Data has been received
+/// }
+/// ~~~~~~~~~~~~~~~
+class radioDataCache{
+	public:
+		static constexpr unsigned int recordSize = 32;
+		static constexpr unsigned int maxSlots = 64;
+		static constexpr uint8_t marker = 0x52;		//'R'
+	private:
+		struct slotIndex{
+			uint32_t frequency = 0;
+			uint16_t programIdentification = 0;
+			uint16_t sequence = 0;
+			bool used = false;
+		};
+		A24C256 & memory;
+		const unsigned int base;
+		const unsigned int slots;
+		const unsigned int requiredObservations;
+		slotIndex index[maxSlots];
+		uint16_t sequence = 0;
+		unsigned int amount = 0;
+		unsigned int corrupted = 0;
+		unsigned int writtenRecords = 0;
+
+		stationInfo candidate;
+		unsigned int observations = 0;
+
+		int findSlot(const uint32_t frequency, const uint16_t programIdentification);
+		unsigned int chooseSlot();
+		bool readSlot(const unsigned int slot, stationInfo & result);
+		void writeSlot(const unsigned int slot, const stationInfo & info);
+		static void encode(const stationInfo & info, const uint16_t sequence, uint8_t record[recordSize]);
+		static bool decode(const uint8_t record[recordSize], stationInfo & result, uint16_t & sequence);
+	public:
+		radioDataCache(A24C256 & memory, const unsigned int base = 8192, const unsigned int slots = maxSlots, const unsigned int requiredObservations = 25);
+
+		unsigned int load();
+		void format();
+
+		bool find(const uint32_t frequency, stationInfo & result, const uint16_t programIdentification = 0);
+		bool observe(const stationInfo & decoded);
+
+		unsigned int getAmount();
+		unsigned int getCorrupted();
+		unsigned int getWrittenRecords();
+};
+
+#endif //__RADIO_DATA_CACHE_HPP
@@ -0,0 +1,148 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "refreshGovernor.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has three optional parameters; the maximum amount of frames per second (defaults to 10), the maximum
+/// amount of frames per second when only background changes are pending (defaults to 1) and the frequency of the ticks
+/// passed to poll() (defaults to 1000; the milliseconds of a taskScheduler).
+refreshGovernor::refreshGovernor(const unsigned int framesPerSecond, const unsigned int backgroundFramesPerSecond, const unsigned int tickFrequency):
+	frameInterval(tickFrequency / ((framesPerSecond > 0) ? framesPerSecond : 1)),
+	backgroundInterval(tickFrequency / ((backgroundFramesPerSecond > 0) ? backgroundFramesPerSecond : 1)),
+	busyTimeout(tickFrequency * 2)
+{}
+
+/// \brief
+/// Request Refresh
+/// \details
+/// This function requests a frame for the given reason; the current time is given in ticks. When a frame is already
+/// pending, the change is drawn with it. The latency of a frame is counted from its first request.
+void refreshGovernor::request(const refreshReason reason, const unsigned int now){
+	requests++;
+	if(pending == 0){
+		pendingSince = now + 1;		//0 means nothing is pending
+	}
+	pending |= uint8_t(reason);
+}
+
+/// \brief
+/// Set Busy
+/// \details
+/// This function tells the governor the radio is tuning or seeking (true), or done (false). While busy, no frames are drawn.
+void refreshGovernor::setBusy(const bool isBusy){
+	busy = isBusy;
+	if(!busy){
+		busyStarted = false;
+	}
+}
+
+/// \brief
+/// Is Busy
+/// \details
+/// This function returns true if the radio is tuning or seeking.
+bool refreshGovernor::isBusy(){
+	return busy;
+}
+
+/// \brief
+/// Is Pending
+/// \details
+/// This function returns true if a frame has been requested but not drawn yet.
+bool refreshGovernor::isPending(){
+	return pending != 0;
+}
+
+/// \brief
+/// Poll for Frame
+/// \details
+/// This function returns true if a frame has to be drawn now; the current time is given in ticks. A frame is drawn when
+/// changes are pending, the radio isn't busy and the frame interval (of the foreground or background, depending on the
+/// pending reasons) has passed since the last frame. The reasons of the frame can be asked with includes().
+bool refreshGovernor::poll(const unsigned int now){
+	if(pending == 0){
+		return false;
+	}
+	if(busy){
+		if(!busyStarted){
+			busyStart = now;
+			busyStarted = true;
+		}
+		if(now - busyStart < busyTimeout){
+			busySkips++;
+			return false;
+		}
+	}
+	const unsigned int interval = (pending & foreground) ? frameInterval : backgroundInterval;
+	if(hasDrawn && now - lastFrame < interval){
+		return false;
+	}
+	const unsigned int latency = now + 1 - pendingSince;
+	if(latency > maxLatency){
+		maxLatency = latency;
+	}
+	drawing = pending;
+	pending = 0;
+	pendingSince = 0;
+	lastFrame = now;
+	hasDrawn = true;
+	frames++;
+	return true;
+}
+
+/// \brief
+/// Frame Includes Reason
+/// \details
+/// This function returns true if the changes of the given reason are part of the frame poll() last returned true for.
+bool refreshGovernor::includes(const refreshReason reason){
+	return drawing & uint8_t(reason);
+}
+
+/// \brief
+/// Get Frames
+/// \details
+/// This function returns the amount of frames drawn since construction or the last reset.
+unsigned int refreshGovernor::getFrames(){
+	return frames;
+}
+
+/// \brief
+/// Get Coalesced Requests
+/// \details
+/// This function returns the amount of requests that didn't need a frame of their own.
+unsigned int refreshGovernor::getCoalesced(){
+	return (requests > frames) ? requests - frames : 0;
+}
+
+/// \brief
+/// Get Maximum Latency
+/// \details
+/// This function returns the longest time (in ticks) a change has been pending before its frame was drawn.
+unsigned int refreshGovernor::getMaxLatency(){
+	return maxLatency;
+}
+
+/// \brief
+/// Reset Statistics
+/// \details
+/// This function sets all statistics to 0. Pending changes are kept.
+void refreshGovernor::resetStatistics(){
+	requests = 0;
+	frames = 0;
+	busySkips = 0;
+	maxLatency = 0;
+}
+
+/// \brief
+/// Print Statistics
+/// \details
+/// This function prints the amount of requests, frames, coalesced requests, polls skipped while busy and the maximum
+/// latency (in ticks) to the given stream.
+void refreshGovernor::printStatistics(hwlib::ostream & stream){
+	stream << hwlib::left << hwlib::setw(12) << "Requests" << hwlib::setw(12) << "Frames" << hwlib::setw(12) << "Coalesced"
+		<< hwlib::setw(12) << "Busy" << hwlib::setw(12) << "Latency" << hwlib::endl;
+	stream << hwlib::left << hwlib::setw(12) << requests << hwlib::setw(12) << frames << hwlib::setw(12) << getCoalesced()
+		<< hwlib::setw(12) << busySkips << hwlib::setw(12) << maxLatency << hwlib::endl;
+}
@@ -0,0 +1,86 @@
+/// @file
+
+#ifndef __REFRESH_GOVERNOR_HPP
+#define __REFRESH_GOVERNOR_HPP
+
+/// \brief
+/// Refresh Reason
+/// \details
+/// These are the reasons the display can have to be refreshed. The frequency and the menu are foreground reasons; the
+/// user is waiting on them. The others are background reasons. The values are bits, so pending reasons can be combined.
+enum class refreshReason : uint8_t {
+	frequency = 0x01,
+	menu = 0x02,
+	signal = 0x04,
+	station = 0x08,
+	clock = 0x10,
+	battery = 0x20
+};
+
+/// \brief
+/// Refresh Governor
+/// \details
+/// This is a class that decides when the display is refreshed. All changes are requested with their reason and
+/// combined into the next frame; however many changes are requested, at most 'framesPerSecond' frames are drawn.
+/// Foreground changes (frequency and menu) get a frame as soon as the frame rate allows. When only background
+/// changes (signal, station name, clock and battery) are pending, the lower 'backgroundFramesPerSecond' applies.
+/// While the radio is tuning or seeking, no frames are drawn at all; the changes stay pending until it's done, or until
+/// it has been busy for two seconds (a seek that never completes shouldn't freeze the display).
+/// This bounds the bus usage of the display and keeps the latency of input predictable.
+///
+///	All supported operations are:
+///		- Request Refresh
+///		- Set/Get Busy (tuning or seeking)
+///		- Poll for a Frame
+///		- Get Reasons of the Frame
+///		- Get/Print/Reset Statistics
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto governor = refreshGovernor(10, 1);
+/// governor.request(refreshReason::menu, scheduler.getTicks());
+/// governor.request(refreshReason::clock, scheduler.getTicks());		//Coalesced into the same frame
+/// for(;;){
+/// 	if(governor.poll(scheduler.getTicks())){
+/// 		display.displayMenuUpdate(...);
+/// 	}
+/// }
+/// ~~~~~~~~~~~~~~~
+class refreshGovernor{
+	private:
+		static constexpr uint8_t foreground = uint8_t(refreshReason::frequency) | uint8_t(refreshReason::menu);
+		const unsigned int frameInterval;
+		const unsigned int backgroundInterval;
+		uint8_t pending = 0;
+		uint8_t drawing = 0;
+		const unsigned int busyTimeout;
+		bool busy = false;
+		bool busyStarted = false;
+		unsigned int busyStart = 0;
+		bool hasDrawn = false;
+		unsigned int lastFrame = 0;
+		unsigned int pendingSince = 0;
+
+		//Statistics
+		unsigned int requests = 0;
+		unsigned int frames = 0;
+		unsigned int busySkips = 0;
+		unsigned int maxLatency = 0;
+	public:
+		refreshGovernor(const unsigned int framesPerSecond = 10, const unsigned int backgroundFramesPerSecond = 1, const unsigned int tickFrequency = 1000);
+
+		void request(const refreshReason reason, const unsigned int now);
+		void setBusy(const bool isBusy = true);
+		bool isBusy();
+		bool isPending();
+
+		bool poll(const unsigned int now);
+		bool includes(const refreshReason reason);
+
+		unsigned int getFrames();
+		unsigned int getCoalesced();
+		unsigned int getMaxLatency();
+		void resetStatistics();
+		void printStatistics(hwlib::ostream & stream);
+};
+
+#endif //__REFRESH_GOVERNOR_HPP
@@ -0,0 +1,111 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "resumeState.hpp"
+
+/// \brief
+/// Compare Records
+/// \details
+/// These operators return whether both records contain the same state. Frequencies are compared in steps of 10kHz,
+/// the resolution in which they are saved.
+bool resumeRecord::operator==(const resumeRecord & other) const {
+	return unsigned(frequency * 100 + 0.5) == unsigned(other.frequency * 100 + 0.5) && volume == other.volume && area == other.area
+		&& muted == other.muted && bassBoost == other.bassBoost && showStationName == other.showStationName;
+}
+
+bool resumeRecord::operator!=(const resumeRecord & other) const {
+	return !(*this == other);
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the (mounted) store. The key under which the record is saved
+/// defaults to 1 and the time the state has to be stable before it is saved to 3000 milliseconds.
+resumeState::resumeState(keyValueStore & store, const uint8_t key, const unsigned int delay):
+	store(store),
+	key(key),
+	delay(delay)
+{}
+
+/// \brief
+/// Load Record
+/// \details
+/// This function fills the given record with the saved state. Returns false, and leaves the record as it was, when
+/// no state of this version has been saved yet.
+bool resumeState::load(resumeRecord & record){
+	uint8_t bytes[recordLength];
+	if(store.get(key, bytes, recordLength) != recordLength || bytes[0] != version){
+		saved = record;
+		return false;
+	}
+	record.frequency = ((bytes[1] << 8) | bytes[2]) / 100.0;
+	record.volume = bytes[3];
+	record.area = bytes[4] >> 4;
+	record.muted = bytes[4] & 0x01;
+	record.bassBoost = bytes[4] & 0x02;
+	record.showStationName = bytes[4] & 0x04;
+	saved = record;
+	return true;
+}
+
+/// \brief
+/// Update Record
+/// \details
+/// This function passes the current state. When it differs from the pending one, the delay starts again. The time
+/// is in milliseconds.
+void resumeState::update(const resumeRecord & record, const unsigned int now){
+	if(record != (changed ? pending : saved)){
+		pending = record;
+		changed = true;
+		lastChange = now;
+	}
+}
+
+/// \brief
+/// Poll
+/// \details
+/// This function saves the pending state when it hasn't changed for 'delay' milliseconds and differs from the saved
+/// one. Returns true when it has been saved. When saving fails, the state stays pending and is tried again.
+bool resumeState::poll(const unsigned int now){
+	if(!changed || now - lastChange < delay){
+		return false;
+	}
+	if(pending == saved){
+		changed = false;
+		return false;		//Changed back in the meantime
+	}
+	const unsigned int hundredths = pending.frequency * 100 + 0.5;
+	const uint8_t bytes[recordLength] = {
+		version,
+		uint8_t(hundredths >> 8),
+		uint8_t(hundredths & 0xFF),
+		pending.volume,
+		uint8_t((pending.area << 4) | (pending.muted ? 0x01 : 0) | (pending.bassBoost ? 0x02 : 0) | (pending.showStationName ? 0x04 : 0))
+	};
+	if(!store.set(key, bytes, recordLength)){
+		return false;		//Still pending; tried again with the next poll
+	}
+	changed = false;
+	saved = pending;
+	saves++;
+	return true;
+}
+
+/// \brief
+/// Is Save Pending
+/// \details
+/// This function returns true if the state has changed and hasn't been saved yet.
+bool resumeState::isPending(){
+	return changed;
+}
+
+/// \brief
+/// Get Amount of Saves
+/// \details
+/// This function returns how many times the state has been saved since construction.
+unsigned int resumeState::getSaves(){
+	return saves;
+}
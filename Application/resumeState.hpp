@@ -0,0 +1,74 @@
+/// @file
+
+#ifndef __RESUME_STATE_HPP
+#define __RESUME_STATE_HPP
+
+#include "keyValueStore.hpp"
+
+/// \brief
+/// Resume Record
+/// \details
+/// This struct contains everything needed to continue where the radio was turned off; the frequency (in MHz), the
+/// volume, the menu area and whether the radio was muted, bass boosted and showing the Radio Data station name.
+struct resumeRecord{
+	float frequency = 100.7;
+	uint8_t volume = 15;
+	uint8_t area = 0;
+	bool muted = false;
+	bool bassBoost = false;
+	bool showStationName = true;
+
+	bool operator==(const resumeRecord & other) const;
+	bool operator!=(const resumeRecord & other) const;
+};
+
+/// \brief
+/// Resume State
+/// \details
+/// This is a class that keeps the resume record in a keyValueStore. Changes aren't saved right away; only when the
+/// state hasn't changed for 'delay' milliseconds, it is saved with one record. Turning the volume knob or searching
+/// for a station then costs one write instead of dozens. At startup, the record is taken from the index the store
+/// has built while mounting; that is, from the one sequential read of the store.
+///
+///	All supported operations are:
+///		- Load Record
+///		- Update Record
+///		- Poll (save when it has been stable long enough)
+///		- Is Save Pending
+///		- Get Amount of Saves
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto settings = keyValueStore(memory, 4096, 1024);
+/// settings.mount();
+/// auto resume = resumeState(settings);
+/// resumeRecord state;
+/// resume.load(state);
+/// radio.begin(state.muted);
+/// radio.setFrequency(state.frequency);
+///
+/// resume.update(state, scheduler.getTicks());
+/// resume.poll(scheduler.getTicks());
+/// ~~~~~~~~~~~~~~~
+class resumeState{
+	private:
+		static constexpr uint8_t version = 1;
+		static constexpr unsigned int recordLength = 5;
+		keyValueStore & store;
+		const uint8_t key;
+		const unsigned int delay;
+		resumeRecord saved;
+		resumeRecord pending;
+		bool changed = false;
+		unsigned int lastChange = 0;
+		unsigned int saves = 0;
+	public:
+		resumeState(keyValueStore & store, const uint8_t key = 1, const unsigned int delay = 3000);
+
+		bool load(resumeRecord & record);
+		void update(const resumeRecord & record, const unsigned int now);
+		bool poll(const unsigned int now);
+		bool isPending();
+		unsigned int getSaves();
+};
+
+#endif //__RESUME_STATE_HPP
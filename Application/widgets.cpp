@@ -0,0 +1,668 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "widgets.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the window the widget draws in. A new widget is changed, so it is
+/// drawn with the first render.
+widget::widget(hwlib::window & window):
+	window(window)
+{}
+
+/// \brief
+/// Render
+/// \details
+/// This function draws the widget when it has changed since the last render. It returns true if it has been drawn.
+bool widget::render(){
+	if(!changed){
+		return false;
+	}
+	draw();
+	changed = false;
+	renders++;
+	return true;
+}
+
+/// \brief
+/// Invalidate
+/// \details
+/// This function marks the widget changed, so the next render() draws it even when its value is the same.
+void widget::invalidate(){
+	changed = true;
+}
+
+/// \brief
+/// Is Changed
+/// \details
+/// This function returns true if the widget will be drawn with the next render().
+bool widget::isChanged(){
+	return changed;
+}
+
+/// \brief
+/// Get Renders
+/// \details
+/// This function returns how many times the widget has been drawn.
+unsigned int widget::getRenders(){
+	return renders;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the window that is flushed after rendering the children. For the
+/// root of the tree this is the display itself.
+widgetGroup::widgetGroup(hwlib::window & window):
+	widget(window)
+{
+	changed = false;
+}
+
+/// \brief
+/// Draw
+/// \details
+/// A group has nothing to draw itself.
+void widgetGroup::draw(){}
+
+/// \brief
+/// Add Child
+/// \details
+/// This function adds a widget to the group. Returns false when the group is full.
+bool widgetGroup::add(widget & child){
+	if(amountOfChildren >= maxChildren){
+		return false;
+	}
+	children[amountOfChildren++] = &child;
+	return true;
+}
+
+/// \brief
+/// Render
+/// \details
+/// This function renders all children and flushes the window once if any of them has been drawn. It returns true if
+/// anything has been drawn.
+bool widgetGroup::render(){
+	bool drawn = false;
+	for(unsigned int i = 0; i < amountOfChildren; i++){
+		drawn |= children[i]->render();
+	}
+	if(drawn){
+		window.flush();
+		renders++;
+		flushes++;
+	}
+	return drawn;
+}
+
+/// \brief
+/// Invalidate
+/// \details
+/// This function invalidates all children.
+void widgetGroup::invalidate(){
+	for(unsigned int i = 0; i < amountOfChildren; i++){
+		children[i]->invalidate();
+	}
+}
+
+/// \brief
+/// Is Changed
+/// \details
+/// This function returns true if any of the children has changed.
+bool widgetGroup::isChanged(){
+	for(unsigned int i = 0; i < amountOfChildren; i++){
+		if(children[i]->isChanged()){
+			return true;
+		}
+	}
+	return false;
+}
+
+/// \brief
+/// Get Flushes
+/// \details
+/// This function returns how many times the window has been flushed by this group.
+unsigned int widgetGroup::getFlushes(){
+	return flushes;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the window and the font. The font isn't copied, so it has to
+/// exist as long as the label does. The text is optional.
+label::label(hwlib::window & window, const hwlib::font & font, const char * text):
+	widget(window),
+	terminal(window, font)
+{
+	set(text);
+}
+
+/// \brief
+/// Set Text
+/// \details
+/// This function copies the given text (at most 16 characters) and marks the label changed when it differs from
+/// the current text.
+void label::set(const char * newText){
+	unsigned int i = 0;
+	for(; i < maxLength && newText[i] != '\0'; i++){
+		if(text[i] != newText[i]){
+			text[i] = newText[i];
+			changed = true;
+		}
+	}
+	if(text[i] != '\0'){
+		text[i] = '\0';
+		changed = true;
+	}
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function clears the window and prints the text.
+void label::draw(){
+	terminal << "\f" << text;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the window and the font. The amount of decimals defaults to 0.
+numericField::numericField(hwlib::window & window, const hwlib::font & font, const unsigned int decimals):
+	widget(window),
+	terminal(window, font),
+	decimals(decimals)
+{}
+
+/// \brief
+/// Set Value
+/// \details
+/// This function sets the value; 1007 with one decimal is shown as 100.7.
+void numericField::set(const int newValue){
+	if(newValue != value){
+		value = newValue;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Highlight
+/// \details
+/// This function shows (true) or hides (false) the '<' and '>' around the value.
+void numericField::highlight(const bool highlight){
+	if(highlight != highlighted){
+		highlighted = highlight;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function clears the window and prints the value with its decimals.
+void numericField::draw(){
+	unsigned int divider = 1;
+	for(unsigned int i = 0; i < decimals; i++){
+		divider *= 10;
+	}
+	const unsigned int magnitude = (value < 0) ? -value : value;
+	terminal << "\f" << (highlighted ? '<' : ' ');
+	if(value < 0){
+		terminal << '-';
+	}
+	terminal << magnitude / divider;
+	if(decimals > 0){
+		terminal << '.';
+		for(unsigned int digit = divider / 10; digit > 0; digit /= 10){
+			terminal << (magnitude / digit) % 10;
+		}
+	}
+	terminal << (highlighted ? '>' : ' ');
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the window and the position of the bottom of the first bar. There are
+/// 5 bars by default, 2 pixels apart, each 2 pixels higher than the previous one.
+barIndicator::barIndicator(hwlib::window & window, const hwlib::xy & position, const unsigned int bars, const unsigned int spacing, const unsigned int heightIncrement):
+	widget(window),
+	position(position),
+	bars(bars),
+	spacing(spacing),
+	heightIncrement(heightIncrement)
+{}
+
+/// \brief
+/// Set Amount
+/// \details
+/// This function sets the amount of bars to show; from 0 to the amount of bars.
+void barIndicator::set(const unsigned int newAmount){
+	const unsigned int limited = (newAmount < bars) ? newAmount : bars;
+	if(limited != amount){
+		amount = limited;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function clears the window and draws the bars.
+void barIndicator::draw(){
+	window.clear();
+	for(unsigned int i = 0; i < amount; i++){
+		const hwlib::xy bottom(position.x + spacing * i, position.y);
+		hwlib::line(bottom, hwlib::xy(bottom.x, bottom.y - heightIncrement * (i + 1))).draw(window);
+	}
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the window and the position of the icon. The height defaults to 5
+/// and the width to 15.
+batteryIndicator::batteryIndicator(hwlib::window & window, const hwlib::xy & position, const unsigned int height, const unsigned int width):
+	widget(window),
+	position(position),
+	height(height),
+	width(width)
+{}
+
+/// \brief
+/// Set Percentage
+/// \details
+/// This function sets the percentage to show; from 0 to 100.
+void batteryIndicator::set(const unsigned int newPercentage){
+	const unsigned int limited = (newPercentage < 100) ? newPercentage : 100;
+	if(limited != percentage){
+		percentage = limited;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function clears the window, draws the outline and tip and fills the icon from the right.
+void batteryIndicator::draw(){
+	window.clear();
+	const hwlib::xy topRight(position.x + width, position.y + height);
+	hwlib::line(position, hwlib::xy(position.x, topRight.y)).draw(window);
+	hwlib::line(hwlib::xy(topRight.x, position.y), hwlib::xy(topRight.x, topRight.y + 1)).draw(window);
+	hwlib::line(hwlib::xy(position.x, topRight.y), topRight).draw(window);
+	hwlib::line(position, hwlib::xy(topRight.x, position.y)).draw(window);
+	hwlib::line(hwlib::xy(position.x - 1, position.y + 1), hwlib::xy(position.x - 1, topRight.y - 1)).draw(window);
+	for(unsigned int i = 0; i <= width * percentage / 100; i++){
+		hwlib::line(hwlib::xy(topRight.x - i, position.y), hwlib::xy(topRight.x - i, topRight.y)).draw(window);
+	}
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has four mandatory parameters; the window, the font, the names of the items and the amount of items.
+/// The names aren't copied. The first item is selected.
+menuList::menuList(hwlib::window & window, const hwlib::font & font, const char * const * items, const unsigned int amountOfItems):
+	widget(window),
+	terminal(window, font),
+	items(items),
+	amountOfItems((amountOfItems < maxItems) ? amountOfItems : maxItems)
+{}
+
+/// \brief
+/// Select
+/// \details
+/// This function selects the item with the given index; invalid indices are ignored.
+void menuList::select(const unsigned int index){
+	if(index < amountOfItems && index != selected){
+		selected = index;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Set Value
+/// \details
+/// This function sets the value that is shown after the name of the item with the given index.
+void menuList::setValue(const unsigned int index, const int value){
+	if(index < amountOfItems && (!hasValue[index] || values[index] != value)){
+		values[index] = value;
+		hasValue[index] = true;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Get Selected
+/// \details
+/// This function returns the index of the selected item.
+unsigned int menuList::getSelected(){
+	return selected;
+}
+
+/// \brief
+/// Get Amount of Items
+/// \details
+/// This function returns the amount of items in the list.
+unsigned int menuList::getAmountOfItems(){
+	return amountOfItems;
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function clears the window and prints all items; one per line.
+void menuList::draw(){
+	terminal << "\f";
+	for(unsigned int i = 0; i < amountOfItems; i++){
+		if(i > 0){
+			terminal << "\n";
+		}
+		terminal << ((i == selected) ? "-> " : "   ") << items[i];
+		if(hasValue[i]){
+			terminal << values[i];
+		}
+	}
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the window and the font. The font isn't copied, so it has to
+/// exist as long as the marquee does. The amount of pixels the text moves per scroll() defaults to 1. The colors
+/// are taken from the glyph of a space, so the text looks exactly like text printed by a terminal.
+marquee::marquee(hwlib::window & window, const hwlib::font & font, const unsigned int pixelsPerFrame):
+	widget(window),
+	font(font),
+	pixelsPerFrame((pixelsPerFrame > 0) ? pixelsPerFrame : 1),
+	paper(font[' '][hwlib::xy(0, 0)]),
+	ink(window.foreground)
+{
+	const auto & glyph = font['#'];
+	for(int x = 0; x < glyph.size.x; x++){
+		for(int y = 0; y < glyph.size.y; y++){
+			if(glyph[hwlib::xy(x, y)] != paper){
+				ink = glyph[hwlib::xy(x, y)];
+			}
+		}
+	}
+}
+
+/// \brief
+/// Rasterize
+/// \details
+/// This function draws the text, without trailing spaces, into the strip; bit y of a byte is row y of that column.
+/// When the text is wider than the window, a gap of spaces is added so the end and the start don't touch while scrolling.
+void marquee::rasterize(){
+	unsigned int length = 0;
+	for(unsigned int i = 0; text[i] != '\0'; i++){
+		if(text[i] != ' '){
+			length = i + 1;
+		}
+	}
+	columns = 0;
+	for(unsigned int i = 0; i < length + gap; i++){
+		const auto & glyph = font[(i < length) ? text[i] : ' '];
+		const int height = (glyph.size.y < 8) ? glyph.size.y : 8;
+		for(int x = 0; x < glyph.size.x && columns < maxColumns; x++){
+			uint8_t column = 0;
+			for(int y = 0; y < height; y++){
+				if(glyph[hwlib::xy(x, y)] != paper){
+					column |= (1 << y);
+				}
+			}
+			strip[columns++] = column;
+		}
+		if(i + 1 == length){
+			scrolling = columns > unsigned(window.size.x);
+			if(!scrolling){
+				break;
+			}
+		}
+	}
+	if(length == 0){
+		scrolling = false;
+	}
+	offset = scrolling ? offset % columns : 0;		//A text that is still being received keeps its position
+}
+
+/// \brief
+/// Set Text
+/// \details
+/// This function copies the given text (at most 64 characters; the text doesn't have to be null-terminated when it
+/// is that long) and rasterizes it when it differs from the current text. A scrolling text keeps its position, so a
+/// text that is still being received doesn't jump back to its start with every new part; see restart().
+void marquee::set(const char * newText){
+	bool different = false;
+	unsigned int i = 0;
+	for(; i < maxLength && newText[i] != '\0'; i++){
+		if(text[i] != newText[i]){
+			text[i] = newText[i];
+			different = true;
+		}
+	}
+	if(text[i] != '\0'){
+		text[i] = '\0';
+		different = true;
+	}
+	if(different){
+		rasterize();
+		changed = true;
+	}
+}
+
+/// \brief
+/// Restart
+/// \details
+/// This function shows the text from its start again; for when it has been replaced by a different text.
+void marquee::restart(){
+	if(offset != 0){
+		offset = 0;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Scroll
+/// \details
+/// This function moves the text to the left. It returns true, and marks the marquee changed, when the text is scrolling;
+/// text that fits in the window stays where it is. Call it at a fixed rate for a smooth movement.
+bool marquee::scroll(){
+	if(!scrolling){
+		return false;
+	}
+	offset = (offset + pixelsPerFrame) % columns;
+	changed = true;
+	return true;
+}
+
+/// \brief
+/// Is Scrolling
+/// \details
+/// This function returns true if the text is wider than the window and thus scrolls.
+bool marquee::isScrolling(){
+	return scrolling;
+}
+
+/// \brief
+/// Invalidate
+/// \details
+/// This function marks the marquee changed and forgets what is shown, so the next render() writes every column.
+void marquee::invalidate(){
+	shownValid = false;
+	changed = true;
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function copies the visible slice of the strip to the window. Only the columns that differ from what is shown
+/// are written; when scrolling, the strip wraps around.
+void marquee::draw(){
+	const unsigned int visible = (unsigned(window.size.x) < maxVisible) ? window.size.x : maxVisible;
+	const int height = (window.size.y < 8) ? window.size.y : 8;
+	for(unsigned int x = 0; x < visible; x++){
+		uint8_t column = 0;
+		if(scrolling){
+			column = strip[(offset + x) % columns];
+		} else if(x < columns){
+			column = strip[x];
+		}
+		if(column != shown[x] || !shownValid){
+			for(int y = 0; y < height; y++){
+				window.write(hwlib::xy(x, y), ((column >> y) & 1) ? ink : paper);
+			}
+			shown[x] = column;
+		}
+	}
+	shownValid = true;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the window. Its width is the amount of columns (at most 128); its
+/// height the maximum height of a column.
+spectrumGraph::spectrumGraph(hwlib::window & window):
+	widget(window)
+{
+	invalidate();
+}
+
+/// \brief
+/// Mark Column
+/// \details
+/// This function marks the given column, so it is drawn with the next render.
+void spectrumGraph::mark(const unsigned int column){
+	if(column < maxColumns){
+		dirty[column] = true;
+		changed = true;
+	}
+}
+
+/// \brief
+/// Set Column
+/// \details
+/// This function sets the height (in pixels) of the given column. Only a different height marks the column.
+void spectrumGraph::set(const unsigned int column, const unsigned int height){
+	const unsigned int limited = (height < unsigned(window.size.y)) ? height : window.size.y;
+	if(column < maxColumns && heights[column] != limited){
+		heights[column] = limited;
+		mark(column);
+	}
+}
+
+/// \brief
+/// Clear
+/// \details
+/// This function sets the height of all columns to 0.
+void spectrumGraph::clear(){
+	for(unsigned int i = 0; i < maxColumns; i++){
+		set(i, 0);
+	}
+}
+
+/// \brief
+/// Set Cursor
+/// \details
+/// This function moves the cursor to the given column; the column it was at and the new column are marked.
+void spectrumGraph::setCursor(const unsigned int column){
+	if(column != cursor && column < maxColumns){
+		mark(cursor);
+		cursor = column;
+		mark(cursor);
+	}
+}
+
+/// \brief
+/// Get Cursor
+/// \details
+/// This function returns the column the cursor is at.
+unsigned int spectrumGraph::getCursor(){
+	return cursor;
+}
+
+/// \brief
+/// Invalidate
+/// \details
+/// This function marks all columns, so the next render() draws the complete graph.
+void spectrumGraph::invalidate(){
+	for(unsigned int i = 0; i < maxColumns; i++){
+		mark(i);
+	}
+}
+
+/// \brief
+/// Draw Column
+/// \details
+/// This function draws one column from the bottom of the window up. Above the bar, the cursor is a dotted line.
+void spectrumGraph::drawColumn(const unsigned int column){
+	const int height = window.size.y;
+	for(int y = 0; y < height; y++){
+		bool set = y >= height - heights[column];
+		if(column == cursor && !set){
+			set = (y % 2) == 0;
+		}
+		window.write(hwlib::xy(column, y), set ? window.foreground : window.background);
+	}
+}
+
+/// \brief
+/// Draw
+/// \details
+/// This function draws the marked columns only.
+void spectrumGraph::draw(){
+	const unsigned int columns = (unsigned(window.size.x) < maxColumns) ? window.size.x : maxColumns;
+	for(unsigned int i = 0; i < columns; i++){
+		if(dirty[i]){
+			drawColumn(i);
+			dirty[i] = false;
+		}
+	}
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the buffer and its size (including the null-terminator).
+textStream::textStream(char * buffer, const unsigned int size):
+	buffer(buffer),
+	size(size)
+{
+	if(size > 0){
+		buffer[0] = '\0';
+	}
+}
+
+/// \brief
+/// Put Character
+/// \details
+/// This function appends the character to the buffer when it fits.
+void textStream::putc(char c){
+	if(length + 1 < size){
+		buffer[length++] = c;
+		buffer[length] = '\0';
+	}
+}
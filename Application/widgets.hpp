@@ -0,0 +1,268 @@
+/// @file
+
+#ifndef __WIDGETS_HPP
+#define __WIDGETS_HPP
+
+/// \brief
+/// Widget
+/// \details
+/// This is an abstract class for all parts of the GUI. A widget owns a window (part) of the display and holds
+/// the value it shows. Setting a value that differs from the current one marks the widget changed; render()
+/// only draws changed widgets. The amount of renders is counted, so the redraw behaviour can be tested.
+///
+/// A widget draws in its window without flushing it; the widgetGroup at the root of the tree flushes the
+/// display once after rendering all of its changed children.
+class widget{
+	protected:
+		hwlib::window & window;
+		bool changed = true;
+		unsigned int renders = 0;
+		virtual void draw() = 0;
+	public:
+		widget(hwlib::window & window);
+		virtual bool render();
+		virtual void invalidate();
+		virtual bool isChanged();
+		unsigned int getRenders();
+};
+
+/// \brief
+/// Widget Group
+/// \details
+/// This is a widget that contains other widgets (groups as well); it forms the tree of the GUI. Rendering a group
+/// renders its changed children and flushes its window once when anything has been drawn.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto root = widgetGroup(oled);
+/// auto frequency = numericField(frequencyWindow, largeFont, 1);
+/// root.add(frequency);
+/// frequency.set(1007);
+/// root.render();			//Draws 100.7
+/// root.render();			//Draws nothing
+/// ~~~~~~~~~~~~~~~
+class widgetGroup : public widget {
+	private:
+		static constexpr unsigned int maxChildren = 12;
+		std::array<widget*, maxChildren> children = {};
+		unsigned int amountOfChildren = 0;
+		unsigned int flushes = 0;
+	protected:
+		void draw() override;
+	public:
+		widgetGroup(hwlib::window & window);
+		bool add(widget & child);
+		bool render() override;
+		void invalidate() override;
+		bool isChanged() override;
+		unsigned int getFlushes();
+};
+
+/// \brief
+/// Label
+/// \details
+/// This is a widget that shows a line of text of at most 16 characters.
+class label : public widget {
+	private:
+		static constexpr unsigned int maxLength = 16;
+		hwlib::terminal_from terminal;
+		char text[maxLength + 1] = {};
+	protected:
+		void draw() override;
+	public:
+		label(hwlib::window & window, const hwlib::font & font, const char * text = "");
+		void set(const char * newText);
+};
+
+/// \brief
+/// Numeric Field
+/// \details
+/// This is a widget that shows an integer as a fixed-point number with the given amount of decimals; 1007 with
+/// one decimal is shown as 100.7. When highlighted, the number is surrounded by '<' and '>'.
+class numericField : public widget {
+	private:
+		hwlib::terminal_from terminal;
+		const unsigned int decimals;
+		int value = 0;
+		bool highlighted = false;
+	protected:
+		void draw() override;
+	public:
+		numericField(hwlib::window & window, const hwlib::font & font, const unsigned int decimals = 0);
+		void set(const int newValue);
+		void highlight(const bool highlight = true);
+};
+
+/// \brief
+/// Bar Indicator
+/// \details
+/// This is a widget that shows an amount as bars of increasing height, like the signal bars known from mobile
+/// phones. The position is the bottom of the first bar, relative to the window of the widget.
+class barIndicator : public widget {
+	private:
+		const hwlib::xy position;
+		const unsigned int bars;
+		const unsigned int spacing;
+		const unsigned int heightIncrement;
+		unsigned int amount = 0;
+	protected:
+		void draw() override;
+	public:
+		barIndicator(hwlib::window & window, const hwlib::xy & position, const unsigned int bars = 5, const unsigned int spacing = 2, const unsigned int heightIncrement = 2);
+		void set(const unsigned int newAmount);
+};
+
+/// \brief
+/// Battery Indicator
+/// \details
+/// This is a widget that shows a percentage as a battery icon which is filled from the right. The position is the
+/// bottom left corner of the icon, relative to the window of the widget. The tip is drawn left of the position.
+class batteryIndicator : public widget {
+	private:
+		const hwlib::xy position;
+		const unsigned int height;
+		const unsigned int width;
+		unsigned int percentage = 0;
+	protected:
+		void draw() override;
+	public:
+		batteryIndicator(hwlib::window & window, const hwlib::xy & position, const unsigned int height = 5, const unsigned int width = 15);
+		void set(const unsigned int newPercentage);
+};
+
+/// \brief
+/// Menu List
+/// \details
+/// This is a widget that shows a list of at most 8 items, one per line, of which one is selected ("-> "). Items
+/// can have a value, which is shown after the name.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// const char * items[] = {"Vol: ", "Bass: ", "Back"};
+/// auto settings = menuList(settingsWindow, font, items, 3);
+/// settings.setValue(0, radio.getVolume());
+/// settings.select(1);
+/// ~~~~~~~~~~~~~~~
+class menuList : public widget {
+	private:
+		static constexpr unsigned int maxItems = 8;
+		hwlib::terminal_from terminal;
+		const char * const * items;
+		const unsigned int amountOfItems;
+		int values[maxItems] = {};
+		bool hasValue[maxItems] = {};
+		unsigned int selected = 0;
+	protected:
+		void draw() override;
+	public:
+		menuList(hwlib::window & window, const hwlib::font & font, const char * const * items, const unsigned int amountOfItems);
+		void select(const unsigned int index);
+		void setValue(const unsigned int index, const int value);
+		unsigned int getSelected();
+		unsigned int getAmountOfItems();
+};
+
+/// \brief
+/// Marquee
+/// \details
+/// This is a widget that shows a line of text of at most 64 characters (a RadioText for example) in a window that is too
+/// small for it, by scrolling it. The text is rasterized only once, when it changes, into a strip of glyph columns in RAM;
+/// one byte per column. Scrolling copies the visible slice of that strip to the window, column by column, and only
+/// the columns that differ from what is shown are written. The display therefore only has to send those columns.
+/// Text that fits isn't scrolled at all. Fonts of at most 8 pixels high are supported.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto ticker = marquee(stationWindow, font);
+/// ticker.set(radio.radioData.stationText());
+/// for(;;){
+/// 	ticker.scroll();			//One pixel per frame
+/// 	ticker.render();
+/// 	oled.flush();
+/// 	hwlib::wait_ms(50);
+/// }
+/// ~~~~~~~~~~~~~~~
+class marquee : public widget {
+	private:
+		static constexpr unsigned int maxLength = 64;
+		static constexpr unsigned int gap = 3;				//Spaces between the end and the start of a scrolling text
+		static constexpr unsigned int maxColumns = (maxLength + gap) * 8;
+		static constexpr unsigned int maxVisible = 128;
+		const hwlib::font & font;
+		const unsigned int pixelsPerFrame;
+		const hwlib::color paper;
+		hwlib::color ink;
+		char text[maxLength + 1] = {};
+		uint8_t strip[maxColumns] = {};
+		uint8_t shown[maxVisible] = {};
+		unsigned int columns = 0;
+		unsigned int offset = 0;
+		bool scrolling = false;
+		bool shownValid = false;
+
+		void rasterize();
+	protected:
+		void draw() override;
+	public:
+		marquee(hwlib::window & window, const hwlib::font & font, const unsigned int pixelsPerFrame = 1);
+		void set(const char * newText);
+		void restart();
+		bool scroll();
+		bool isScrolling();
+		void invalidate() override;
+};
+
+/// \brief
+/// Spectrum Graph
+/// \details
+/// This is a widget that shows a bar graph of at most 128 columns; one column per pixel, with a dotted cursor line at one
+/// of them. Every column is drawn on its own: setting a column or moving the cursor only marks those columns, and only the
+/// marked columns are drawn with the next render. A band scan that adds one column at a time therefore never redraws
+/// the whole graph.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto spectrum = spectrumGraph(spectrumWindow);
+/// spectrum.set(10, 40);		//Column 10 is 40 pixels high
+/// spectrum.setCursor(10);
+/// spectrum.render();			//Only draws column 10 and where the cursor was
+/// ~~~~~~~~~~~~~~~
+class spectrumGraph : public widget {
+	private:
+		static constexpr unsigned int maxColumns = 128;
+		uint8_t heights[maxColumns] = {};
+		bool dirty[maxColumns] = {};
+		unsigned int cursor = 0;
+
+		void mark(const unsigned int column);
+		void drawColumn(const unsigned int column);
+	protected:
+		void draw() override;
+	public:
+		spectrumGraph(hwlib::window & window);
+		void set(const unsigned int column, const unsigned int height);
+		void clear();
+		void setCursor(const unsigned int column);
+		unsigned int getCursor();
+		void invalidate() override;
+};
+
+/// \brief
+/// Text Stream
+/// \details
+/// This is a hwlib::ostream that prints into a character buffer; it makes it possible to show everything that can
+/// be printed (a dateData for example) in a label. The buffer is always null-terminated; what doesn't fit is dropped.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// char text[17];
+/// auto stream = textStream(text, sizeof(text));
+/// stream << "    " << date;
+/// menuLabel.set(text);
+/// ~~~~~~~~~~~~~~~
+class textStream : public hwlib::ostream {
+	private:
+		char * buffer;
+		const unsigned int size;
+		unsigned int length = 0;
+	public:
+		textStream(char * buffer, const unsigned int size);
+		void putc(char c) override;
+};
+
+#endif //__WIDGETS_HPP
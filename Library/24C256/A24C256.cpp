@@ -43,35 +43,34 @@ A24C256::A24C256(hwlib::i2c_bus_bit_banged_scl_sda & bus, unsigned int givenMemo
 /// This function takes two mandatory parameters; location and value.
 /// The location has to be valid for the value to be written. The location
 /// is divided in two parts; MSB and LSB. The location and value are written 
-/// at once. It takes 5ms for the EEPROM to become responsive again. 
-/// Waiting these 5ms prevents weird things from happening.
+/// at once. It can take up to 5ms for the EEPROM to become responsive again; this
+/// function returns as soon as it is. When the write-back cache is enabled, the
+/// value is only stored in the cache; it is saved by flush().
 void A24C256::write(unsigned int location, uint8_t value){
+	if(writeBack){
+		if(location < memorySize){
+			cacheByte(location, value);
+		}
+		return;
+	}
 	if(location >= 0 && location < memorySize){
 		data[0] = location >> 8;						//MSB Location
 		data[1] = location & 0xFF;						//LSB Location
 		data[2] = value;								//Value to save
 		bus.write(address).write(data, 3);
+		waitForWriteCycle();
 	}
-	hwlib::wait_ms(5); 									//Datasheet states it can take up to 5ms for the chip to become responsive again.
 }
 
 /// \brief
 /// Single Byte read
 /// \details
 /// This function takes one mandatory parameter; the location. If the location 
-/// is valid, it returns the value that is currently saved at the desired position.
-/// Otherwise, it returns 0 to emphasize failure.
+/// is valid, it returns the value that is currently saved at the desired position; or
+/// waiting to be saved in the write-back cache. Otherwise, it returns 0 to emphasize failure.
 uint8_t A24C256::read(unsigned int location){
-	if(location >= 0 && location < memorySize){
-		uint8_t receivedData;
-		data[0] = location >> 8;
-		data[1] = location & 0xFF;
-		bus.write(address).write(data, 2);				//Tell which address to get data from
-		bus.read(address).read(&receivedData, 1);		//Retrieve data
-		return receivedData;
-	} else {
-		return 0;
-	}
+	uint8_t receivedData = 0;
+	return read(location, 1, &receivedData);
 }
 
 /// \brief
@@ -87,79 +86,70 @@ uint8_t A24C256::read(unsigned int location){
 /// Though not all microcontrollers or I2C libraries can handle this.
 /// To make this library user-friendly you can choose which one to use.
 /// 
+/// The value ends at its terminating zero; use the binary write below to save data that contains zeroes.
+void A24C256::write(unsigned int location, char* value, bool largeBuffer){
+	unsigned int length = 0;
+	while(value[length]){
+		length++;
+	}
+	writePages(location, reinterpret_cast<const uint8_t *>(value), length, largeBuffer ? getPageSize() : 32);
+}
+
+/// \brief
+/// Binary Multi Byte write
+/// \details
+/// This function saves 'length' bytes from 'value' beginning at the given location; any byte value, zeroes included,
+/// can be saved. Returns false when the data doesn't fit in the memory (nothing is written then) or when the chip
+/// didn't complete a write cycle in time.
+///
 ///	Pages
 /// The memory consists of pages of 64 bytes each. When an
 ///	edge of a page is reached, the write process will continue
 ///	at the beginning of this current page; thus overwriting data.
-///	To prevent that from happening, we monitor when this will happen.
-///	We'll write multiple bytes of amount 'pageSize' or as much that
-///	will fit in the current page. If there is data left, we'll write
-///	that to the next page.
-void A24C256::write(unsigned int location, char* value, bool largeBuffer){
-	if(location >= 0 && location < memorySize){
-		unsigned int pageSize;
-		/*						Buffer-Size
-		A Buffer-size of 64 bytes is faster and more efficient.
-		Though not all microcontrollers or I2C libraries can handle this.
-		To make this library user-friendly you can choose which one to use.
-		*/
-		if (largeBuffer) {
-			pageSize = 64;
-		} else {
-			pageSize = 32;
-		}
-		unsigned int length = 0;
-		while(value[length]){
-			length++;
+///	To prevent that from happening, the data is split at the page
+///	boundaries and every part is written with its own write cycle.
+bool A24C256::write(unsigned int location, const uint8_t * value, size_t length){
+	return writePages(location, value, length, getPageSize());
+}
+
+/// \brief
+/// Write Pages
+/// \details
+/// This function splits the given data at the boundaries of pages of 'pageSize' bytes. Every part is sent straight
+/// from the given data after the two location bytes, in one transaction, followed by one write cycle. Pending
+/// writes in the write-back cache are saved first, so the order of all writes is kept; the cached page is
+/// updated with the written bytes.
+bool A24C256::writePages(const unsigned int location, const uint8_t * value, const size_t length, const unsigned int pageSize){
+	if(location >= memorySize || length > memorySize - location){
+		return false;
+	}
+	flush();
+	bool completed = true;
+	size_t written = 0;
+	while(written < length){
+		const unsigned int start = location + written;
+		size_t part = pageSize - (start % pageSize);			//Bytes left until the end of this page
+		if(part > length - written){
+			part = length - written;
 		}
-		/*						Pages
-		The memory consists of pages of 64 bytes each. When an
-		edge of a page is reached, the write process will continue
-		at the beginning of this current page; thus overwriting data.
-		To prevent that from happening, we monitor when this will happen.
-		We'll write multiple bytes of amount 'pageSize' or as much that
-		will fit in the current page. If there is data left, we'll write
-		that to the next page.
-		*/
-		if(length + location < memorySize){						//Check whether all data will actually fit whithout overwriting data at the beginning of the page.
-			if(length + (location % pageSize) < pageSize){		//If the date doesn't cross a page-boundary;
-				data[0] = location >> 8;						//Just write as if it is a normal write operation.
-				data[1] = location & 0xFF;
-				for(unsigned int i = 0; i < length; i++){
-					data[i+2] = uint8_t(value[i]);
-				}
-				bus.write(address).write(data, length+2);
-				hwlib::wait_ms(5);
-			} else {																						//If it doesn't fit in one page.
-				unsigned int cycles = (length + (location % pageSize)) / pageSize;							//Calculate over how many pages the data has to be distributed.
-				if(float((float(length) + (float(location % pageSize)) / pageSize) - length) > 0.0){		//If there is data left to save;
-					cycles++;																				//add another write-cycle
-				}
-				for(unsigned int i = 0; i <= cycles; i++){
-					data[0] = location >> 8;
-					data[1] = location & 0xFF;
-					//If there has to be another write after this one; there is data left.
-					if(cycles > i){
-						for(unsigned int j = 0; j <= pageSize; j++){						//Put the max amount of data in buffer until page-boundary is reached
-							data[j+2] = uint8_t(value[j+(i * pageSize)]);					// Reminder: first two bytes form the beginning location to save the data
-						}
-						location+=pageSize;
-						bus.write(address).write(data, pageSize + 2);
-						hwlib::wait_ms(5);
-					//Last write operation; only beginning is data to be saved.
-					} else {																//If last cycle is reached we only need to write the left-over bytes;
-						for(unsigned int j = 0; j < length % pageSize; j++){				//amount % 64 = amount to write in last cycle
-							data[j+2] = uint8_t(value[j+(cycles * pageSize)]);
-						}
-						location += length % pageSize;										//Update location from where we can start again; past the page-boundary
-						bus.write(address).write(data, (length % pageSize + 2));
-						hwlib::wait_ms(5);
-					}
-				}
+		const uint8_t locationBytes[] = {uint8_t(start >> 8), uint8_t(start & 0xFF)};
+		{
+			auto transaction = bus.write(address);
+			transaction.write(locationBytes, 2);
+			transaction.write(&value[written], part);
+		}														//The write cycle starts at the stop condition
+		completed &= waitForWriteCycle();
+		written += part;
+	}
+	if(cachedPage != noPage){
+		const unsigned int pageStart = cachedPage * getPageSize();
+		for(unsigned int i = 0; i < getPageSize(); i++){
+			if(pageStart + i >= location && pageStart + i < location + length){
+				cache[i] = value[pageStart + i - location];
 			}
-			hwlib::wait_ms(5);
 		}
 	}
+	return completed;
 }
 
 
@@ -169,13 +159,22 @@ void A24C256::write(unsigned int location, char* value, bool largeBuffer){
 /// This function takes a couple of arguments. The location is the address where to start
 /// reading from. The length is the amount of bytes to read and receivedData is the variable
 /// to store data in. If the location is valid, the data will be returned. Otherwise 0
-/// will be returned to emphasize failure.
+/// will be returned to emphasize failure. Bytes that are still in the write-back cache are
+/// returned as written.
+///
+/// The chip keeps the address following the last byte it has read. When reading continues
+/// there, the location isn't sent again; reading a large structure in parts then costs no
+/// more than reading it at once. This assumes no other object talks to the same chip.
 uint8_t A24C256::read(unsigned int location, unsigned int length, uint8_t receivedData[]){
 	if(location >= 0 && location < memorySize){
-		data[0] = location >> 8;
-		data[1] = location & 0xFF;
-		bus.write(address).write(data, 2);
+		if(location != addressCounter){
+			data[0] = location >> 8;
+			data[1] = location & 0xFF;
+			bus.write(address).write(data, 2);					//Tell which address to get data from
+		}
 		bus.read(address).read(receivedData, length);				//Read multiple bytes at once
+		addressCounter = (location + length) % memorySize;
+		applyCache(location, length, receivedData);
 		return *receivedData;
 	} else {
 		return 0;
@@ -187,6 +186,187 @@ uint8_t A24C256::read(unsigned int location, unsigned int length, uint8_t receiv
 	*/
 }
 
+/// \brief
+/// Wait For Write Cycle
+/// \details
+/// This function waits until the chip has saved the data that has just been written. Instead of waiting the worst-case
+/// 5ms of the datasheet, the chip is addressed until it acknowledges; it doesn't while its write cycle is busy. The
+/// time it took is added to the write cycle statistics. When the chip hasn't acknowledged after 'writeCycleTimeout'
+/// microseconds (it might not be connected at all), the timeout is counted and false is returned.
+bool A24C256::waitForWriteCycle(){
+	addressCounter = noLocation;			//Not worth keeping track of after writing
+	const auto start = hwlib::now_us();
+	bool acknowledged = false;
+	uint_fast64_t duration = 0;
+	while(!acknowledged && duration < writeCycleTimeout){
+		bus.write_start();
+		bus.write_byte(address << 1);
+		acknowledged = bus.read_ack();
+		bus.write_stop();
+		duration = hwlib::now_us() - start;
+	}
+	if(acknowledged){
+		writeCycles.cycles++;
+		writeCycles.totalTime += duration;
+		writeCycles.lastTime = duration;
+		if(duration > writeCycles.longestTime){
+			writeCycles.longestTime = duration;
+		}
+	} else {
+		writeCycles.timeouts++;
+	}
+	return acknowledged;
+}
+
+/// \brief
+/// Get Write Cycle Statistics
+/// \details
+/// This function returns the amount of write cycles, how long they took (in microseconds) and how often the chip
+/// didn't acknowledge in time.
+writeCycleStatistics A24C256::getWriteCycleStatistics(){
+	return writeCycles;
+}
+
+/// \brief
+/// Reset Write Cycle Statistics
+/// \details
+/// This function clears the write cycle statistics.
+void A24C256::resetWriteCycleStatistics(){
+	writeCycles = writeCycleStatistics();
+}
+
+/// \brief
+/// Set Write Cycle Timeout
+/// \details
+/// This function sets how long (in microseconds) is waited for the chip to complete a write cycle; it defaults to
+/// 10ms, twice the maximum of the datasheet.
+void A24C256::setWriteCycleTimeout(const unsigned int timeout){
+	writeCycleTimeout = timeout;
+}
+
+/// \brief
+/// Get Page Size
+/// \details
+/// This function returns the size of the pages that are cached; 32 bytes for the 24C32 and 24C64 and 64 bytes
+/// for the others. Larger chips have larger pages, but 64 bytes always fit in one of those.
+unsigned int A24C256::getPageSize(){
+	return (memorySize <= 64 * 128) ? 32 : 64;
+}
+
+/// \brief
+/// Cache Byte
+/// \details
+/// This function stores the given value in the write-back cache. When the location is in another page than the
+/// cached one, the cached page is saved first and the new page is read, so the bytes in between the written ones
+/// keep their value when the page is saved.
+void A24C256::cacheByte(const unsigned int location, const uint8_t value){
+	const unsigned int pageSize = getPageSize();
+	const unsigned int page = location / pageSize;
+	if(page != cachedPage){
+		flush();
+		cachedPage = noPage;
+		read(page * pageSize, pageSize, cache);
+		cachedPage = page;
+	}
+	const unsigned int offset = location % pageSize;
+	cache[offset] = value;
+	if(dirtyStart >= dirtyEnd){
+		dirtyStart = offset;
+		dirtyEnd = offset + 1;
+	} else if(offset < dirtyStart){
+		dirtyStart = offset;
+	} else if(offset >= dirtyEnd){
+		dirtyEnd = offset + 1;
+	}
+}
+
+/// \brief
+/// Apply Cache
+/// \details
+/// This function replaces the bytes of the given read that are in the cached page by the content of the cache.
+void A24C256::applyCache(const unsigned int location, const unsigned int length, uint8_t receivedData[]){
+	if(cachedPage == noPage){
+		return;
+	}
+	const unsigned int pageSize = getPageSize();
+	const unsigned int pageStart = cachedPage * pageSize;
+	for(unsigned int i = 0; i < pageSize; i++){
+		if(pageStart + i >= location && pageStart + i < location + length){
+			receivedData[pageStart + i - location] = cache[i];
+		}
+	}
+}
+
+/// \brief
+/// Drop Cache
+/// \details
+/// This function forgets the cached page, so it is read again from the chip when it is written next time.
+void A24C256::dropCache(){
+	cachedPage = noPage;
+	dirtyStart = 0;
+	dirtyEnd = 0;
+}
+
+/// \brief
+/// Enable Write-Back Cache
+/// \details
+/// This function enables (true) or disables (false) the write-back cache. When enabled, single byte writes are kept
+/// in a cache of one page. They are saved with one page write when flush() is called, or when a byte in another page
+/// is written; a few bytes then cost one write cycle instead of one each. Disabling the cache saves what is pending.
+void A24C256::setWriteBack(const bool enable){
+	if(!enable){
+		flush();
+		dropCache();
+	}
+	writeBack = enable;
+}
+
+/// \brief
+/// Is Write-Back Cache Enabled
+/// \details
+/// This function returns true if single byte writes are cached.
+bool A24C256::getWriteBack(){
+	return writeBack;
+}
+
+/// \brief
+/// Flush
+/// \details
+/// This function saves the dirty range of the cached page with one page write. When nothing is pending, nothing is
+/// written. The page stays cached, so reading it doesn't cost a transaction.
+void A24C256::flush(){
+	if(!flushPending()){
+		return;
+	}
+	const unsigned int location = cachedPage * getPageSize() + dirtyStart;
+	const uint8_t locationBytes[] = {uint8_t(location >> 8), uint8_t(location & 0xFF)};
+	{
+		auto transaction = bus.write(address);
+		transaction.write(locationBytes, 2);
+		transaction.write(&cache[dirtyStart], dirtyEnd - dirtyStart);
+	}
+	dirtyStart = 0;
+	dirtyEnd = 0;
+	pageWrites++;
+	waitForWriteCycle();
+}
+
+/// \brief
+/// Flush Pending
+/// \details
+/// This function returns true if there are cached bytes that haven't been saved yet.
+bool A24C256::flushPending(){
+	return dirtyStart < dirtyEnd;
+}
+
+/// \brief
+/// Get Amount of Page Writes
+/// \details
+/// This function returns how many pages have been saved by the write-back cache since construction.
+unsigned int A24C256::getPageWrites(){
+	return pageWrites;
+}
+
 /// \brief
 /// Get I2C address
 /// \details
@@ -202,6 +382,7 @@ uint8_t A24C256::getAddress(){
 /// by applying voltage at A1, A2 and A3 it might be useful to be able to change it.
 void A24C256::setAddress(const uint8_t newAddress){
 	address = newAddress;
+	addressCounter = noLocation;
 }
 
 /// \brief
@@ -219,6 +400,7 @@ unsigned int A24C256::getMemorySize(){
 /// to change the memory size of the object (which is the mandatory parameter).
 void A24C256::setMemorySize(const unsigned int newSize){
 	memorySize = newSize;
+	addressCounter = noLocation;
 }
 
 /// \brief
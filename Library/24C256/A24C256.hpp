@@ -3,6 +3,19 @@
 #ifndef __A24C256_HPP
 #define __A24C256_HPP
 
+/// \brief
+/// Write Cycle Statistics
+/// \details
+/// This struct contains the amount of completed write cycles, their total, longest and last duration in
+/// microseconds and the amount of write cycles that didn't complete within the timeout.
+struct writeCycleStatistics{
+	unsigned int cycles = 0;
+	unsigned int timeouts = 0;
+	uint_fast64_t totalTime = 0;
+	uint_fast64_t longestTime = 0;
+	uint_fast64_t lastTime = 0;
+};
+
 /// \brief
 /// 24C EEPROM Interface
 /// \details
@@ -10,13 +23,16 @@
 /// Completely compatible with 24C24C32, 24C64, 24C128, 24C256, 24C512 and 24C1024. It is
 /// possible to write and read single bytes (chars, bools, integers) and multi-byte values (char[]). By default
 /// , the chip is unable to write multi-byte values accross multiple pages. However, this is dealt with
-/// from within this library.
+/// from within this library. After every write, the chip is polled until it acknowledges again, so
+/// a write takes as long as the chip actually needs instead of the worst-case 5ms of the datasheet.
 /// 
 ///	All supported operations are:
 ///		- Write Single Byte
-///		- Write Multiple Bytes
+///		- Write Multiple Bytes (text or binary)
 ///		- Read Single Byte
-///		- Read Multiple Bytes
+///		- Read Multiple Bytes (sequential reads aren't addressed again)
+///		- Write-Back Cache (coalesce single byte writes per page)
+///		- Get Write Cycle Statistics
 /// 
 /// ~~~~~~~~~~~~~~~{.cpp}
 /// 
@@ -40,6 +56,10 @@
 /// 	//Write 12 bytes to location 20
 /// 	char data[]={"Hello World!"};
 /// 	memory.write(20, data);
+///
+/// 	//Write 4 bytes, zeroes included, to location 40
+/// 	const uint8_t binary[] = {0x12, 0x00, 0x34, 0x00};
+/// 	memory.write(40, binary, 4);
 /// 
 /// 	//Retrieve multiple bytes (preffered)
 /// 	uint8_t receivedData[12];
@@ -83,8 +103,14 @@
 /// 	hwlib::cout << hwlib::setw(100) << hwlib::left << "Write-Protect Enabled: " << memory.getWriteProtect() << hwlib::endl;
 /// 	memory.write(300, 'z');
 /// 	hwlib::cout << hwlib::setw(100) << hwlib::left << "Writing impossible when Write Protection Enabled " << hwlib::boolalpha << (char(memory.read(300)) == 'c') << hwlib::endl;
-/// 
-/// 
+/// 	memory.setWriteProtect(false);
+///
+/// 	//With the write-back cache enabled, these 16 bytes are saved with one page write instead of 16 byte writes.
+/// 	memory.setWriteBack();
+/// 	for(unsigned int i = 0; i < 16; i++){
+/// 		memory.write(128 + i, i);
+/// 	}
+/// 	memory.flush();
 /// }
 ///
 /// ~~~~~~~~~~~~~~~
@@ -94,16 +120,47 @@ class A24C256{
 		unsigned int memorySize;	//This library is also compatible with 24C24C32, 24C64, 24C65, 24C128, 24C256, 24C512, 24C1024
 		uint8_t address;
 		hwlib::pin_in_out & writeProtectPin;
-		uint8_t data[65] = {};		//Two address bytes followed by data to save
+		uint8_t data[3] = {};		//Two address bytes followed by a single byte to save
+
+		static constexpr unsigned int noPage = 0xFFFFFFFF;
+		static constexpr unsigned int noLocation = 0xFFFFFFFF;
+		unsigned int addressCounter = noLocation;	//The location the chip reads next without being addressed
+		bool writeBack = false;
+		uint8_t cache[64] = {};		//Contents of the cached page
+		unsigned int cachedPage = noPage;
+		unsigned int dirtyStart = 0;	//First dirty byte in the cached page
+		unsigned int dirtyEnd = 0;		//One past the last dirty byte; equal to start when clean
+		unsigned int pageWrites = 0;
+		unsigned int writeCycleTimeout = 10000;
+		writeCycleStatistics writeCycles;
+
+		bool waitForWriteCycle();
+		bool writePages(const unsigned int location, const uint8_t * value, const size_t length, const unsigned int pageSize);
+
+		unsigned int getPageSize();
+		void cacheByte(const unsigned int location, const uint8_t value);
+		void applyCache(const unsigned int location, const unsigned int length, uint8_t receivedData[]);
+		void dropCache();
 	public:
 		A24C256(hwlib::i2c_bus_bit_banged_scl_sda & bus, unsigned int givenMemorySize = 256, uint8_t address = 0x50, hwlib::pin_in_out & writeProtectPin = hwlib::pin_in_out_dummy);
 
 		void write(unsigned int location, uint8_t value);
 		void write(unsigned int location, char* value, bool largeBuffer = true);
+		bool write(unsigned int location, const uint8_t * value, size_t length);
 
 		uint8_t read(unsigned int location);
 		uint8_t read(unsigned int location, unsigned int length, uint8_t receivedData[] = {});
 
+		void setWriteBack(const bool enable = true);
+		bool getWriteBack();
+		void flush();
+		bool flushPending();
+		unsigned int getPageWrites();
+
+		writeCycleStatistics getWriteCycleStatistics();
+		void resetWriteCycleStatistics();
+		void setWriteCycleTimeout(const unsigned int timeout);
+
 		uint8_t getAddress();
 		void setAddress(const uint8_t newAddress);
 
@@ -2,6 +2,8 @@
 
 #include "hwlib.hpp"
 #include "A24C256.hpp"
+#include "keyValueStore.hpp"
+#include "eepromStream.hpp"
 
 /// \brief
 /// Test
@@ -66,6 +68,20 @@ int main( void ){
     }
   }
 
+  uint8_t binary[100];
+  for(unsigned int i = 0; i < 100; i++){
+    binary[i] = (i % 3 == 0) ? 0 : i;
+  }
+  memory.write(1000, binary, 100);      //Starts halfway a page and crosses two page boundaries
+  uint8_t binaryReceived[100];
+  memory.read(1000, 100, binaryReceived);
+  bool binaryCorrect = true;
+  for(unsigned int i = 0; i < 100; i++){
+    binaryCorrect &= binaryReceived[i] == binary[i];
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Binary values containing zeroes are written and read correctly: " << hwlib::boolalpha << binaryCorrect << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Binary values are not written if they exceed maximum memory-address: " << hwlib::boolalpha << !memory.write(32760, binary, 100) << hwlib::endl;
+
   memory.write(386, 'c');
   hwlib::cout << hwlib::setw(100) << hwlib::left << "Single-Byte values are written and read correctly: " << hwlib::boolalpha << (char(memory.read(386)) == 'c') << hwlib::endl;
 
@@ -82,4 +98,60 @@ int main( void ){
   memory.write(300, 'z');
   hwlib::cout << hwlib::setw(100) << hwlib::left << "Writing possible again when Write Protection Disabled " << hwlib::boolalpha << (char(memory.read(300)) == 'z') << hwlib::endl;
 
+  memory.setWriteBack();
+  const unsigned int pageWrites = memory.getPageWrites();
+  for(unsigned int i = 0; i < 16; i++){
+    memory.write(448 + i, i + 1);
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Cached bytes are read back before they are saved: " << hwlib::boolalpha << (memory.flushPending() && memory.read(455) == 8) << hwlib::endl;
+  memory.flush();
+  memory.setWriteBack(false);
+  memory.read(448, 16, newReceivedData);
+  bool cachedCorrectly = true;
+  for(unsigned int i = 0; i < 16; i++){
+    cachedCorrectly &= newReceivedData[i] == i + 1;
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Cached bytes in one page are saved with one page write: " << hwlib::boolalpha << (cachedCorrectly && memory.getPageWrites() == pageWrites + 1) << hwlib::endl;
+
+  memory.resetWriteCycleStatistics();
+  memory.write(386, 'd');
+  auto statistics = memory.getWriteCycleStatistics();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Write returns when the chip acknowledges; within 5ms: " << hwlib::boolalpha << (statistics.cycles == 1 && statistics.timeouts == 0 && statistics.lastTime <= 5000) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Measured write cycle (us): " << unsigned(statistics.lastTime) << hwlib::endl;
+
+  memory.setAddress(0x57);      //Nothing is connected at this address
+  memory.setWriteCycleTimeout(2000);
+  memory.write(386, 'e');
+  memory.setAddress(0x50);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Write cycle timeout is counted when the chip doesn't respond: " << hwlib::boolalpha << (memory.getWriteCycleStatistics().timeouts == 1) << hwlib::endl;
+
+  auto settings = keyValueStore(memory, 8192, 256);     //16 records
+  settings.mount();
+  settings.set(1, 12u);
+  settings.set(2, 1007u);
+  for(unsigned int i = 0; i < 40; i++){        //More writes than there are records
+    settings.set(1, i);
+  }
+  auto mounted = keyValueStore(memory, 8192, 256);
+  mounted.mount();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Key/value store keeps the newest value of every key after mounting: " << hwlib::boolalpha << (mounted.get(1, 0u) == 39 && mounted.get(2, 0u) == 1007) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Values that don't change are copied ahead instead of overwritten: " << hwlib::boolalpha << (settings.getRelocations() > 0) << hwlib::endl;
+  const unsigned int written = settings.getWrittenRecords();
+  settings.set(1, 39u);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Setting an unchanged value writes nothing: " << hwlib::boolalpha << (settings.getWrittenRecords() == written) << hwlib::endl;
+
+  auto output = eepromOutputStream(memory, 12000);
+  output << "Streamed across page boundaries; " << 12345 << hwlib::flush;
+  auto input = eepromInputStream(memory, 12000);
+  char streamed[40] = {};
+  for(unsigned int i = 0; i < 38; i++){
+    streamed[i] = input.getc();
+  }
+  const char expected[] = {"Streamed across page boundaries; 12345"};
+  bool streamedCorrectly = true;
+  for(unsigned int i = 0; i < 38; i++){
+    streamedCorrectly &= streamed[i] == expected[i];
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Streams write and read sequentially across page boundaries: " << hwlib::boolalpha << (streamedCorrectly && input.tell() == 12038) << hwlib::endl;
+
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "crc8.hpp"
+
+/// \brief
+/// CRC-8
+/// \details
+/// This function returns the CRC-8 (polynomial 0x07) of the given bytes.
+uint8_t crc8(const uint8_t * bytes, const unsigned int length){
+	uint8_t crc = 0;
+	for(unsigned int i = 0; i < length; i++){
+		crc ^= bytes[i];
+		for(unsigned int bit = 0; bit < 8; bit++){
+			crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+		}
+	}
+	return crc;
+}
@@ -0,0 +1,21 @@
+/// @file
+
+#ifndef __CRC8_HPP
+#define __CRC8_HPP
+
+#include "hwlib.hpp"
+
+/// \brief
+/// CRC-8
+/// \details
+/// This function returns the CRC-8 (polynomial 0x07) of the given bytes. All records that are kept in the EEPROM
+/// (key/value records, presets and cached Radio Data) are protected with it.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// uint8_t record[16];
+/// record[15] = crc8(record, 15);
+/// bool valid = crc8(record, 15) == record[15];
+/// ~~~~~~~~~~~~~~~
+uint8_t crc8(const uint8_t * bytes, const unsigned int length);
+
+#endif //__CRC8_HPP
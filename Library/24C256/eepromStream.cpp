@@ -0,0 +1,153 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "eepromStream.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the EEPROM. Reading starts at the given location, which defaults
+/// to 0. Nothing is read until the first byte is requested.
+eepromInputStream::eepromInputStream(A24C256 & memory, const unsigned int location):
+	memory(memory),
+	end(memory.getMemorySize() * 128),
+	location(location)
+{}
+
+/// \brief
+/// Fill Buffer
+/// \details
+/// This function reads the bytes following the buffer into it. Returns false when the end of the memory has been
+/// reached.
+bool eepromInputStream::fill(){
+	location += filled;
+	position = 0;
+	filled = 0;
+	if(location >= end){
+		return false;
+	}
+	filled = (end - location < bufferSize) ? end - location : bufferSize;
+	memory.read(location, filled, buffer);
+	return true;
+}
+
+/// \brief
+/// Get Character
+/// \details
+/// This function returns the next byte. At the end of the memory, 0 is returned.
+char eepromInputStream::getc(){
+	if(position >= filled && !fill()){
+		return 0;
+	}
+	return buffer[position++];
+}
+
+/// \brief
+/// Character Available
+/// \details
+/// This function returns true as long as the end of the memory hasn't been reached.
+bool eepromInputStream::char_available(){
+	return location + position < end;
+}
+
+/// \brief
+/// Read Bytes
+/// \details
+/// This function copies the next 'length' bytes to 'data' and returns how many bytes have been copied; less than
+/// requested only at the end of the memory.
+unsigned int eepromInputStream::read(uint8_t * data, const unsigned int length){
+	unsigned int copied = 0;
+	while(copied < length){
+		if(position >= filled && !fill()){
+			break;
+		}
+		while(copied < length && position < filled){
+			data[copied++] = buffer[position++];
+		}
+	}
+	return copied;
+}
+
+/// \brief
+/// Skip Bytes
+/// \details
+/// This function passes the given amount of bytes. Bytes that haven't been read ahead yet aren't read at all.
+void eepromInputStream::skip(const unsigned int length){
+	seek(tell() + length);
+}
+
+/// \brief
+/// Seek
+/// \details
+/// This function continues reading at the given location. When it is in the buffer, nothing has to be read again.
+void eepromInputStream::seek(const unsigned int newLocation){
+	if(newLocation >= location && newLocation < location + filled){
+		position = newLocation - location;
+	} else {
+		location = newLocation;
+		position = 0;
+		filled = 0;
+	}
+}
+
+/// \brief
+/// Get Location
+/// \details
+/// This function returns the location of the byte that is read next.
+unsigned int eepromInputStream::tell(){
+	return location + position;
+}
+
+//<<<------------------------------------------------------------------------------>>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the EEPROM. Writing starts at the given location, which defaults
+/// to 0.
+eepromOutputStream::eepromOutputStream(A24C256 & memory, const unsigned int location):
+	memory(memory),
+	location(location)
+{}
+
+/// \brief
+/// Put Character
+/// \details
+/// This function adds one byte. When it is the last byte of a page, the page is saved.
+void eepromOutputStream::putc(char c){
+	const uint8_t value = c;
+	write(&value, 1);
+}
+
+/// \brief
+/// Write Bytes
+/// \details
+/// This function adds the given bytes. Every page that is completed is saved with one page write.
+void eepromOutputStream::write(const uint8_t * data, const unsigned int length){
+	for(unsigned int i = 0; i < length; i++){
+		buffer[filled++] = data[i];
+		if((location + filled) % sizeof(buffer) == 0){
+			flush();
+		}
+	}
+}
+
+/// \brief
+/// Flush
+/// \details
+/// This function saves the bytes that have been collected so far. When nothing has been collected, nothing is written.
+void eepromOutputStream::flush(){
+	if(filled > 0){
+		memory.write(location, buffer, filled);
+		location += filled;
+		filled = 0;
+	}
+}
+
+/// \brief
+/// Get Location
+/// \details
+/// This function returns the location the next byte is written to.
+unsigned int eepromOutputStream::tell(){
+	return location + filled;
+}
@@ -0,0 +1,81 @@
+/// @file
+
+#ifndef __EEPROM_STREAM_HPP
+#define __EEPROM_STREAM_HPP
+
+#include "A24C256.hpp"
+
+/// \brief
+/// EEPROM Input Stream
+/// \details
+/// This is a hwlib::istream that reads a 24CXXX EEPROM sequentially, starting at a given location. A small buffer
+/// is filled ahead; when it runs empty, the next bytes are read where the chip left off, so the location isn't
+/// sent again. Large stored structures can be parsed a few bytes at a time without a buffer of their size and at
+/// the speed of one long read.
+///
+///	All supported operations are:
+///		- Get Character (through hwlib::istream)
+///		- Read Bytes
+///		- Skip Bytes
+///		- Seek
+///		- Get Location
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto stream = eepromInputStream(memory, 4096);
+/// uint8_t record[16];
+/// while(stream.read(record, 16) == 16 && record[0] != 0xFF){
+/// 	//Parse record
+/// }
+/// ~~~~~~~~~~~~~~~
+class eepromInputStream : public hwlib::istream {
+	public:
+		static constexpr unsigned int bufferSize = 32;
+	private:
+		A24C256 & memory;
+		const unsigned int end;
+		unsigned int location;			//Location of the first byte in the buffer
+		unsigned int position = 0;		//Next byte in the buffer
+		unsigned int filled = 0;		//Amount of valid bytes in the buffer
+		uint8_t buffer[bufferSize] = {};
+
+		bool fill();
+	public:
+		eepromInputStream(A24C256 & memory, const unsigned int location = 0);
+
+		char getc() override;
+		bool char_available() override;
+		unsigned int read(uint8_t * data, const unsigned int length);
+		void skip(const unsigned int length);
+		void seek(const unsigned int newLocation);
+		unsigned int tell();
+};
+
+/// \brief
+/// EEPROM Output Stream
+/// \details
+/// This is a hwlib::ostream that writes a 24CXXX EEPROM sequentially, starting at a given location. Written bytes
+/// are collected until the end of the current page is reached; that page is then saved with one page write. flush()
+/// saves what has been collected so far. Everything that can be printed to a hwlib::ostream can be stored this way.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto stream = eepromOutputStream(memory, 8192);
+/// stream << "Q-Music" << '\0';
+/// stream.write(record, 16);
+/// stream.flush();
+/// ~~~~~~~~~~~~~~~
+class eepromOutputStream : public hwlib::ostream {
+	private:
+		A24C256 & memory;
+		unsigned int location;			//Location of the first byte in the buffer
+		unsigned int filled = 0;
+		uint8_t buffer[64] = {};
+	public:
+		eepromOutputStream(A24C256 & memory, const unsigned int location = 0);
+
+		void putc(char c) override;
+		void write(const uint8_t * data, const unsigned int length);
+		void flush() override;
+		unsigned int tell();
+};
+
+#endif //__EEPROM_STREAM_HPP
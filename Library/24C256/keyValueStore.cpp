@@ -0,0 +1,276 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "keyValueStore.hpp"
+#include "crc8.hpp"
+#include "eepromStream.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the EEPROM. The region of the store starts at 'firstLocation' and
+/// is 'size' bytes long; both are rounded down to a multiple of 16 bytes, the size of one record. It defaults to
+/// the 4KB after the first 4KB of the chip. Nothing is read until mount() is called.
+keyValueStore::keyValueStore(A24C256 & memory, const unsigned int firstLocation, const unsigned int size):
+	memory(memory),
+	firstLocation(firstLocation - (firstLocation % recordSize)),
+	slots(size / recordSize)
+{}
+
+/// \brief
+/// Find Key
+/// \details
+/// This function returns the entry of the given key, or nullptr if the key isn't in the store.
+keyValueEntry * keyValueStore::find(const uint8_t key){
+	for(unsigned int i = 0; i < amount; i++){
+		if(entries[i].key == key){
+			return &entries[i];
+		}
+	}
+	return nullptr;
+}
+
+/// \brief
+/// Owner Of Slot
+/// \details
+/// This function returns the entry of which the current record is in the given slot, or nullptr if the record
+/// in that slot has been superseded (or the slot is empty).
+keyValueEntry * keyValueStore::ownerOf(const unsigned int slot){
+	for(unsigned int i = 0; i < amount; i++){
+		if(entries[i].slot == slot){
+			return &entries[i];
+		}
+	}
+	return nullptr;
+}
+
+/// \brief
+/// Mount
+/// \details
+/// This function reads all records in the region as one sequential stream, and keeps the one with the highest sequence
+/// number of every key. Records of which the CRC doesn't match (torn by a power failure) are counted and ignored.
+/// The head of the log is placed right after the newest record. Returns the amount of keys found.
+unsigned int keyValueStore::mount(){
+	amount = 0;
+	corrupted = 0;
+	sequence = 0;
+	head = 0;
+	auto stream = eepromInputStream(memory, firstLocation);
+	uint8_t record[recordSize];
+	for(unsigned int slot = 0; slot < slots; slot++){
+		stream.read(record, recordSize);
+		if(record[0] != marker){
+			continue;			//Never written
+		}
+		if(crc8(record, recordSize - 1) != record[recordSize - 1] || record[2] > maxLength){
+			corrupted++;
+			continue;
+		}
+		const uint32_t recordSequence = (uint32_t(record[3]) << 24) | (uint32_t(record[4]) << 16) | (uint32_t(record[5]) << 8) | record[6];
+		if(recordSequence >= sequence){
+			sequence = recordSequence;
+			head = (slot + 1) % slots;
+		}
+		keyValueEntry * entry = find(record[1]);
+		if(entry == nullptr){
+			if(amount >= maxKeys){
+				continue;
+			}
+			entry = &entries[amount++];
+		} else if(entry->sequence > recordSequence){
+			continue;			//An older value
+		}
+		entry->key = record[1];
+		entry->length = record[2];
+		entry->sequence = recordSequence;
+		entry->slot = slot;
+		for(unsigned int j = 0; j < maxLength; j++){
+			entry->value[j] = record[7 + j];
+		}
+	}
+	return amount;
+}
+
+/// \brief
+/// Write Record
+/// \details
+/// This function writes the given entry as a new record at the head, with the next sequence number, and moves the
+/// head one slot ahead. The entry only points to the new slot once the record has been written.
+bool keyValueStore::writeRecord(keyValueEntry & entry){
+	uint8_t record[recordSize];
+	const uint32_t recordSequence = sequence + 1;
+	record[0] = marker;
+	record[1] = entry.key;
+	record[2] = entry.length;
+	record[3] = recordSequence >> 24;
+	record[4] = recordSequence >> 16;
+	record[5] = recordSequence >> 8;
+	record[6] = recordSequence;
+	for(unsigned int i = 0; i < maxLength; i++){
+		record[7 + i] = (i < entry.length) ? entry.value[i] : 0xFF;
+	}
+	record[recordSize - 1] = crc8(record, recordSize - 1);
+	if(!memory.write(firstLocation + head * recordSize, record, recordSize)){
+		return false;
+	}
+	writtenRecords++;
+	sequence = recordSequence;
+	entry.sequence = recordSequence;
+	entry.slot = head;
+	head = (head + 1) % slots;
+	return true;
+}
+
+/// \brief
+/// Append
+/// \details
+/// This function appends the given entry to the log. When the head is at the current record of another key, that
+/// record is copied to the first free slot ahead first; the slot it came from can only be overwritten once the
+/// copy exists, which is in the next round. The current record of the key itself is simply passed, since it is
+/// superseded by this one. Returns false when writing fails.
+bool keyValueStore::append(keyValueEntry & entry){
+	keyValueEntry * owner = ownerOf(head);
+	while(owner != nullptr){
+		if(owner->key == entry.key){
+			head = (head + 1) % slots;
+		} else {
+			const unsigned int slot = head;
+			do{
+				head = (head + 1) % slots;
+			} while(ownerOf(head) != nullptr);
+			if(!writeRecord(*owner)){
+				head = slot;
+				return false;
+			}
+			relocations++;		//The slot it came from is free from now on; it is used again next round
+		}
+		owner = ownerOf(head);
+	}
+	return writeRecord(entry);
+}
+
+/// \brief
+/// Set Value
+/// \details
+/// This function saves the given value (at most 8 bytes) under the given key. When the value is the same as the
+/// current one, nothing is written. Returns false when the value is too long, there is no room for another key or
+/// writing failed; the previous value is kept then.
+bool keyValueStore::set(const uint8_t key, const uint8_t * value, const unsigned int length){
+	if(length > maxLength){
+		return false;
+	}
+	keyValueEntry * current = find(key);
+	if(current != nullptr && current->length == length){
+		bool same = true;
+		for(unsigned int i = 0; i < length; i++){
+			same &= current->value[i] == value[i];
+		}
+		if(same){
+			return true;
+		}
+	}
+	if(current == nullptr && (amount >= maxKeys || amount + 1 >= slots)){
+		return false;			//There has to be at least one free slot
+	}
+	keyValueEntry updated;
+	updated.key = key;
+	updated.length = length;
+	updated.slot = slots;			//Not in any slot yet
+	for(unsigned int i = 0; i < length; i++){
+		updated.value[i] = value[i];
+	}
+	if(!append(updated)){
+		return false;
+	}
+	if(current == nullptr){
+		current = &entries[amount++];
+	}
+	*current = updated;
+	return true;
+}
+
+/// \brief
+/// Set Integer Value
+/// \details
+/// This function saves the given integer under the given key as 4 bytes.
+bool keyValueStore::set(const uint8_t key, const uint32_t value){
+	const uint8_t bytes[] = {uint8_t(value >> 24), uint8_t(value >> 16), uint8_t(value >> 8), uint8_t(value)};
+	return set(key, bytes, 4);
+}
+
+/// \brief
+/// Get Value
+/// \details
+/// This function copies at most 'length' bytes of the value of the given key to 'value' and returns the length of
+/// the value. When the key isn't in the store, 0 is returned and nothing is copied.
+unsigned int keyValueStore::get(const uint8_t key, uint8_t * value, const unsigned int length){
+	keyValueEntry * entry = find(key);
+	if(entry == nullptr){
+		return 0;
+	}
+	for(unsigned int i = 0; i < entry->length && i < length; i++){
+		value[i] = entry->value[i];
+	}
+	return entry->length;
+}
+
+/// \brief
+/// Get Integer Value
+/// \details
+/// This function returns the integer saved under the given key, or the given default when the key isn't in the
+/// store or isn't an integer.
+uint32_t keyValueStore::get(const uint8_t key, const uint32_t defaultValue){
+	keyValueEntry * entry = find(key);
+	if(entry == nullptr || entry->length != 4){
+		return defaultValue;
+	}
+	return (uint32_t(entry->value[0]) << 24) | (uint32_t(entry->value[1]) << 16) | (uint32_t(entry->value[2]) << 8) | entry->value[3];
+}
+
+/// \brief
+/// Contains Key
+/// \details
+/// This function returns true if a value has been saved under the given key.
+bool keyValueStore::contains(const uint8_t key){
+	return find(key) != nullptr;
+}
+
+/// \brief
+/// Get Amount of Keys
+/// \details
+/// This function returns the amount of keys in the store.
+unsigned int keyValueStore::getAmount(){
+	return amount;
+}
+
+/// \brief
+/// Get Amount of Slots
+/// \details
+/// This function returns the amount of records that fit in the region.
+unsigned int keyValueStore::getSlots(){
+	return slots;
+}
+
+/// \brief
+/// Get Amount of Corrupted Records
+/// \details
+/// This function returns how many records have been ignored by the last mount() because their CRC didn't match.
+unsigned int keyValueStore::getCorrupted(){
+	return corrupted;
+}
+
+/// \brief
+/// Get Amount of Written Records
+/// \details
+/// This function returns how many records have been written since construction; relocated ones included.
+unsigned int keyValueStore::getWrittenRecords(){
+	return writtenRecords;
+}
+
+/// \brief
+/// Get Amount of Relocations
+/// \details
+/// This function returns how many current records have been copied ahead of the head since construction.
+unsigned int keyValueStore::getRelocations(){
+	return relocations;
+}
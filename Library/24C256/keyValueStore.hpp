@@ -0,0 +1,100 @@
+/// @file
+
+#ifndef __KEY_VALUE_STORE_HPP
+#define __KEY_VALUE_STORE_HPP
+
+#include "A24C256.hpp"
+
+/// \brief
+/// Key Value Entry
+/// \details
+/// This struct contains the current value of one key; its length, the sequence number of the record it
+/// has last been written with and the slot that record is in.
+///
+/// Used internally by keyValueStore.
+struct keyValueEntry{
+	uint8_t key = 0;
+	uint8_t length = 0;
+	uint32_t sequence = 0;
+	unsigned int slot = 0;
+	uint8_t value[8] = {};
+};
+
+/// \brief
+/// Key Value Store
+/// \details
+/// This is a wear-leveled key/value store on a region of a 24CXXX EEPROM. Values of up to 8 bytes are saved
+/// under a key of one byte. The region is a circular log of records of 16 bytes; a marker, the key, the length,
+/// a sequence number, the value and a CRC-8. Since a record is written with one page write and never crosses a
+/// page, it is either written completely or its CRC doesn't match.
+///
+/// Changing a value never overwrites its current record. A new record is appended at the head of the log, so
+/// the old one stays valid until the new one has been written completely; a power failure at any moment leaves
+/// either the old or the new value. Writes move around the complete region, so every cell wears equally. When
+/// the head reaches a record that is still current, that record is copied ahead first (compaction); values that
+/// never change don't keep their cells from being used.
+///
+/// mount() reads the region and builds an index in RAM of the record with the highest sequence number per key.
+/// Getting a value never touches the bus; setting a value that hasn't changed doesn't either.
+///
+///	All supported operations are:
+///		- Mount (build the index)
+///		- Set Value
+///		- Get Value
+///		- Contains Key
+///		- Get Amount of Keys
+///		- Get Amount of Corrupted Records
+///		- Get Amount of Written Records and Relocations
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto memory = A24C256(i2c_bus);
+/// auto settings = keyValueStore(memory, 4096, 4096);
+/// settings.mount();
+///
+/// settings.set(1, 12);		//Volume
+/// hwlib::cout << settings.get(1, 8) << hwlib::endl;
+///
+/// const uint8_t name[] = {"Q-Music"};
+/// settings.set(2, name, 7);
+/// ~~~~~~~~~~~~~~~
+class keyValueStore{
+	public:
+		static constexpr unsigned int maxKeys = 16;
+		static constexpr unsigned int maxLength = 8;
+		static constexpr unsigned int recordSize = 16;
+	private:
+		static constexpr uint8_t marker = 0x4B;
+		A24C256 & memory;
+		const unsigned int firstLocation;
+		const unsigned int slots;
+		keyValueEntry entries[maxKeys];
+		unsigned int amount = 0;
+		unsigned int head = 0;
+		uint32_t sequence = 0;
+		unsigned int corrupted = 0;
+		unsigned int writtenRecords = 0;
+		unsigned int relocations = 0;
+
+		keyValueEntry * find(const uint8_t key);
+		keyValueEntry * ownerOf(const unsigned int slot);
+		bool writeRecord(keyValueEntry & entry);
+		bool append(keyValueEntry & entry);
+	public:
+		keyValueStore(A24C256 & memory, const unsigned int firstLocation = 4096, const unsigned int size = 4096);
+
+		unsigned int mount();
+
+		bool set(const uint8_t key, const uint8_t * value, const unsigned int length);
+		bool set(const uint8_t key, const uint32_t value);
+		unsigned int get(const uint8_t key, uint8_t * value, const unsigned int length);
+		uint32_t get(const uint8_t key, const uint32_t defaultValue);
+		bool contains(const uint8_t key);
+
+		unsigned int getAmount();
+		unsigned int getSlots();
+		unsigned int getCorrupted();
+		unsigned int getWrittenRecords();
+		unsigned int getRelocations();
+};
+
+#endif //__KEY_VALUE_STORE_HPP
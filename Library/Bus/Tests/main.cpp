@@ -0,0 +1,49 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "busScheduler.hpp"
+
+/// \brief
+/// Test
+/// \details
+/// This program tests ALL functionality of the Bus Scheduler. No chips are needed; the tasks only
+/// keep track of the order in which they are served.
+int main( void ){
+  hwlib::wait_ms(1000);   //Wait for terminal
+
+  char order[16] = {};
+  unsigned int served = 0;
+  unsigned int displayChunks = 0;
+
+  auto radioData = busFunction([&](){ order[served++] = 'R'; return true; });
+  auto signal = busFunction([&](){ order[served++] = 'S'; return true; });
+  auto display = busFunction([&](){ order[served++] = 'D'; return ++displayChunks % 4 == 0; });   //Completes after 4 chunks
+
+  auto bus = busScheduler();
+  hwlib::cout << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "Tasks can be added: " << (bus.add(display, busPriority::display, "Display") && bus.add(signal, busPriority::signal, "Signal") && bus.add(radioData, busPriority::radioData, "Radio Data")) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Nothing is done when nothing is requested: " << !bus.run() << hwlib::endl;
+
+  bus.request(display);
+  bus.request(signal);
+  bus.request(radioData);
+  bus.run();
+  bus.run();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Highest priority is served first: " << (order[0] == 'R' && order[1] == 'S') << hwlib::endl;
+
+  bus.run();
+  bus.request(radioData);
+  bus.run();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "High priority task goes in between chunks of a long transfer: " << (order[2] == 'D' && order[3] == 'R' && bus.isPending(display)) << hwlib::endl;
+
+  bus.runAll();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Long transfer completes after all chunks: " << (!bus.isPending(display) && displayChunks == 4) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Requests are counted per task: " << (bus.getRequests(radioData) == 2 && bus.getRequests(display) == 1) << hwlib::endl;
+
+  bus.request(signal);
+  bus.request(signal);
+  bus.runAll();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Requesting a pending task does not queue it twice: " << (bus.getRequests(signal) == 2 && served == 8) << hwlib::endl;
+
+  hwlib::cout << hwlib::endl;
+  bus.printStatistics(hwlib::cout);
+}
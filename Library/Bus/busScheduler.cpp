@@ -0,0 +1,167 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "busScheduler.hpp"
+
+/// \brief
+/// Find Task
+/// \details
+/// This function returns the index of the slot the given task has been registered in, or -1 when
+/// the task has not been added.
+int busScheduler::find(const busTask & task){
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		if(slots[i].task == &task){
+			return i;
+		}
+	}
+	return -1;
+}
+
+/// \brief
+/// Add Task
+/// \details
+/// This function registers a task with its priority class and a name that is used when printing the
+/// statistics. It returns false when the task could not be added because all slots are in use. Adding
+/// a task twice only changes its priority and name.
+bool busScheduler::add(busTask & task, const busPriority priority, const char * name){
+	auto index = find(task);
+	if(index < 0){
+		if(amountOfTasks >= maxTasks){
+			return false;
+		}
+		index = amountOfTasks++;
+		slots[index] = busSlot();
+		slots[index].task = &task;
+	}
+	slots[index].priority = priority;
+	slots[index].name = name;
+	return true;
+}
+
+/// \brief
+/// Request Task
+/// \details
+/// This function marks the given task as pending. Requesting a task that already is pending does nothing;
+/// its latency is measured from the first request. Requests for tasks that have not been added are ignored.
+void busScheduler::request(busTask & task){
+	auto index = find(task);
+	if(index >= 0 && !slots[index].pending){
+		slots[index].pending = true;
+		slots[index].requestTime = hwlib::now_us();
+		slots[index].requests++;
+	}
+}
+
+/// \brief
+/// Is Pending
+/// \details
+/// This function returns true if the given task has been requested and has not completed yet.
+bool busScheduler::isPending(const busTask & task){
+	auto index = find(task);
+	return index >= 0 && slots[index].pending;
+}
+
+/// \brief
+/// Run One Chunk
+/// \details
+/// This function performs one chunk of the pending task with the highest priority. When tasks share
+/// the same priority, the one that has been waiting the longest goes first. It returns true if a chunk
+/// has been performed, or false when there was nothing to do.
+bool busScheduler::run(){
+	int selected = -1;
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		if(slots[i].pending){
+			if(selected < 0 || slots[i].priority < slots[selected].priority ||
+				(slots[i].priority == slots[selected].priority && slots[i].requestTime < slots[selected].requestTime)){
+				selected = i;
+			}
+		}
+	}
+	if(selected < 0){
+		return false;
+	}
+	auto & slot = slots[selected];
+	slot.chunks++;
+	if(slot.task->busStep()){
+		const uint_fast64_t latency = hwlib::now_us() - slot.requestTime;
+		slot.pending = false;
+		slot.completions++;
+		slot.totalLatency += latency;
+		if(latency > slot.maxLatency){
+			slot.maxLatency = latency;
+		}
+	}
+	return true;
+}
+
+/// \brief
+/// Run All
+/// \details
+/// This function keeps running chunks until no task is pending anymore.
+void busScheduler::runAll(){
+	while(run()){}
+}
+
+/// \brief
+/// Get Requests
+/// \details
+/// This function returns how many times the given task has been requested.
+unsigned int busScheduler::getRequests(const busTask & task){
+	auto index = find(task);
+	if(index < 0){
+		return 0;
+	}
+	return slots[index].requests;
+}
+
+/// \brief
+/// Get Average Latency
+/// \details
+/// This function returns the average time in microseconds between the request and completion of the given task.
+unsigned int busScheduler::getAverageLatency(const busTask & task){
+	auto index = find(task);
+	if(index < 0 || slots[index].completions == 0){
+		return 0;
+	}
+	return slots[index].totalLatency / slots[index].completions;
+}
+
+/// \brief
+/// Get Maximum Latency
+/// \details
+/// This function returns the longest time in microseconds it has taken the given task to complete after being requested.
+unsigned int busScheduler::getMaxLatency(const busTask & task){
+	auto index = find(task);
+	if(index < 0){
+		return 0;
+	}
+	return slots[index].maxLatency;
+}
+
+/// \brief
+/// Reset Statistics
+/// \details
+/// This function resets the kept statistics of all tasks; pending requests remain pending.
+void busScheduler::resetStatistics(){
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		slots[i].requests = 0;
+		slots[i].completions = 0;
+		slots[i].chunks = 0;
+		slots[i].totalLatency = 0;
+		slots[i].maxLatency = 0;
+	}
+}
+
+/// \brief
+/// Print Statistics
+/// \details
+/// This function prints the amount of requests, chunks and the average and maximum latency (in microseconds)
+/// of all registered tasks to the given stream.
+void busScheduler::printStatistics(hwlib::ostream & stream){
+	stream << hwlib::left << hwlib::setw(20) << "Task" << hwlib::setw(10) << "Requests" << hwlib::setw(10) << "Chunks"
+		<< hwlib::setw(12) << "Avg (us)" << hwlib::setw(12) << "Max (us)" << hwlib::endl;
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		stream << hwlib::left << hwlib::setw(20) << slots[i].name << hwlib::setw(10) << slots[i].requests << hwlib::setw(10) << slots[i].chunks
+			<< hwlib::setw(12) << getAverageLatency(*slots[i].task) << hwlib::setw(12) << unsigned(slots[i].maxLatency) << hwlib::endl;
+	}
+}
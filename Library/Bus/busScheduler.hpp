@@ -0,0 +1,117 @@
+/// @file
+
+#ifndef __BUS_SCHEDULER_HPP
+#define __BUS_SCHEDULER_HPP
+
+/// \brief
+/// Bus Priority
+/// \details
+/// These are the priority classes of work on the shared I2C bus. The lower the value, the sooner
+/// the work is served. Capturing a Radio Data Group is the most time-critical since the RDA5807 only
+/// holds one group at a time, flushing the display is the least time-critical.
+enum class busPriority : uint8_t {
+	radioData = 0,
+	signal = 1,
+	clock = 2,
+	memory = 3,
+	display = 4
+};
+
+/// \brief
+/// Bus Task
+/// \details
+/// This is an abstract class for all work that can be scheduled on the shared I2C bus. Every call
+/// to busStep() performs one bounded chunk of bus traffic and returns true when the work has been
+/// completed, or false when there are chunks left. Long transfers (a display flush for example)
+/// should split themselves in chunks so more important reads can be done in between.
+class busTask{
+	public:
+		virtual bool busStep() = 0;
+};
+
+/// \brief
+/// Bus Function
+/// \details
+/// This is a class which makes it possible to turn a lambda into a busTask. The lambda should return
+/// true when it has completed its work.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// unsigned int signalStrength = 0;
+/// auto signalSample = busFunction([&](){ signalStrength = radio.signalStrength(); return true; });
+/// ~~~~~~~~~~~~~~~
+template<typename T>
+class busFunction : public busTask {
+	private:
+		T function;
+	public:
+		busFunction(T function):
+			function(function)
+		{}
+
+		bool busStep() override {
+			return function();
+		}
+};
+
+/// \brief
+/// Bus Scheduler
+/// \details
+/// This is a class that arbitrates the I2C bus shared by the RDA5807, SSD1306, DS3231 and 24C256. Tasks
+/// are registered once with a priority class and requested whenever they have work to do. Every call to
+/// run() performs one chunk of the most important pending task, so a high priority read never has to wait
+/// longer than one chunk of a low priority transfer. For every registered task the amount of requests and
+/// the latency (time between request and completion) are kept.
+///
+///	All supported operations are:
+///		- Add Task
+///		- Request Task
+///		- Run One Chunk or Run All
+///		- Get Latency Statistics
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto bus = busScheduler();
+/// auto radioDataCapture = busFunction([&](){ radio.radioData.update(); return true; });
+/// bus.add(radioDataCapture, busPriority::radioData, "RDS Capture");
+/// bus.add(oled, busPriority::display, "Display Flush");
+/// oled.attach(bus);
+///
+/// for(;;){
+/// 	bus.request(radioDataCapture);
+/// 	bus.run();
+/// }
+/// ~~~~~~~~~~~~~~~
+class busScheduler{
+	private:
+		struct busSlot{
+			busTask * task = nullptr;
+			busPriority priority = busPriority::display;
+			const char * name = "";
+			bool pending = false;
+			uint_fast64_t requestTime = 0;
+			unsigned int requests = 0;
+			unsigned int completions = 0;
+			unsigned int chunks = 0;
+			uint_fast64_t totalLatency = 0;
+			uint_fast64_t maxLatency = 0;
+		};
+		static constexpr unsigned int maxTasks = 8;
+		std::array<busSlot, maxTasks> slots = {};
+		unsigned int amountOfTasks = 0;
+		int find(const busTask & task);
+	public:
+		bool add(busTask & task, const busPriority priority, const char * name);
+
+		void request(busTask & task);
+		bool isPending(const busTask & task);
+
+		bool run();
+		void runAll();
+
+		unsigned int getRequests(const busTask & task);
+		unsigned int getAverageLatency(const busTask & task);
+		unsigned int getMaxLatency(const busTask & task);
+		void resetStatistics();
+		void printStatistics(hwlib::ostream & stream);
+};
+
+#endif //__BUS_SCHEDULER_HPP
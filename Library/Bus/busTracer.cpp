@@ -0,0 +1,298 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "busTracer.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the SCL and SDA pins. They are passed to the
+/// hwlib::i2c_bus_bit_banged_scl_sda this tracer is built upon. Tracing is enabled by default.
+busTracer::busTracer(hwlib::pin_oc & scl, hwlib::pin_oc & sda):
+	i2c_bus_bit_banged_scl_sda(scl, sda)
+{}
+
+/// \brief
+/// Count Duration
+/// \details
+/// This function adds the given duration (in microseconds) to the histogram of the given statistics.
+void busTracer::count(traceStatistics & statistics, const uint_fast64_t duration){
+	static constexpr uint_fast64_t limits[traceStatistics::buckets - 1] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000};
+	unsigned int bucket = 0;
+	while(bucket < traceStatistics::buckets - 1 && duration >= limits[bucket]){
+		bucket++;
+	}
+	statistics.histogram[bucket]++;
+}
+
+/// \brief
+/// Same Name
+/// \details
+/// This function returns true if both names contain the same characters. Names can't be compared by address
+/// since the same string literal used in different files does not have to end up at the same address.
+bool busTracer::sameName(const char * first, const char * second){
+	if(first == nullptr || second == nullptr){
+		return first == second;
+	}
+	while(*first != '\0' && *first == *second){
+		first++;
+		second++;
+	}
+	return *first == *second;
+}
+
+/// \brief
+/// Find Driver By Address
+/// \details
+/// This function returns the statistics of the driver registered with the given address. If there is no
+/// such driver, a new unnamed entry is made. When all entries are in use, the last one is shared.
+traceStatistics & busTracer::findDriver(const uint8_t address){
+	for(unsigned int i = 0; i < amountOfDrivers; i++){
+		if(drivers[i].address == address){
+			return drivers[i];
+		}
+	}
+	if(amountOfDrivers < maxDrivers){
+		drivers[amountOfDrivers].address = address;
+		return drivers[amountOfDrivers++];
+	}
+	return drivers[maxDrivers - 1];
+}
+
+/// \brief
+/// Find Driver By Name
+/// \details
+/// This function returns the statistics of the driver with the given name, or makes a new entry without an
+/// address when it does not exist yet. It returns nullptr when all entries are in use.
+traceStatistics * busTracer::findDriver(const char * name){
+	for(unsigned int i = 0; i < amountOfDrivers; i++){
+		if(drivers[i].name != nullptr && sameName(drivers[i].name, name)){
+			return &drivers[i];
+		}
+	}
+	if(amountOfDrivers < maxDrivers){
+		drivers[amountOfDrivers].name = name;
+		drivers[amountOfDrivers].address = 0;
+		return &drivers[amountOfDrivers++];
+	}
+	return nullptr;
+}
+
+/// \brief
+/// Write Start Condition
+/// \details
+/// This function starts a new transaction; the time is noted and the next byte is expected to be the address.
+void busTracer::write_start(){
+	if(enabled){
+		transactionStart = hwlib::now_us();
+		transactionBytes = 0;
+		expectAddress = true;
+	}
+	i2c_bus_bit_banged_scl_sda::write_start();
+}
+
+/// \brief
+/// Write Stop Condition
+/// \details
+/// This function completes the transaction and adds it to the statistics of the responsible driver and
+/// calling function.
+void busTracer::write_stop(){
+	i2c_bus_bit_banged_scl_sda::write_stop();
+	if(enabled && !expectAddress){
+		const uint_fast64_t duration = hwlib::now_us() - transactionStart;
+		traceStatistics * driver = nullptr;
+		if(scopeDriver != nullptr){
+			driver = findDriver(scopeDriver);
+		}
+		if(driver == nullptr){
+			driver = &findDriver(transactionAddress);
+		}
+		driver->transactions++;
+		driver->bytes += transactionBytes;
+		driver->busTime += duration;
+		count(*driver, duration);
+		if(scopeFunction >= 0){
+			functions[scopeFunction].transactions++;
+			functions[scopeFunction].bytes += transactionBytes;
+			functions[scopeFunction].busTime += duration;
+		}
+	}
+	expectAddress = false;
+}
+
+/// \brief
+/// Write Byte
+/// \details
+/// This function counts the written byte. The first byte of a transaction contains the address.
+void busTracer::write_byte(uint8_t x){
+	if(enabled){
+		if(expectAddress){
+			transactionAddress = x >> 1;
+			expectAddress = false;
+		}
+		transactionBytes++;
+	}
+	i2c_bus_bit_banged_scl_sda::write_byte(x);
+}
+
+/// \brief
+/// Read Byte
+/// \details
+/// This function counts the read byte.
+uint8_t busTracer::read_byte(){
+	if(enabled){
+		transactionBytes++;
+	}
+	return i2c_bus_bit_banged_scl_sda::read_byte();
+}
+
+/// \brief
+/// Add Driver
+/// \details
+/// This function gives a name to the traffic to and from the given address. A driver that uses multiple addresses
+/// (the RDA5807 uses 0x10 and 0x11) can be added once per address. Returns false if there is no room left.
+bool busTracer::addDriver(const char * name, const uint8_t address){
+	for(unsigned int i = 0; i < amountOfDrivers; i++){
+		if(drivers[i].address == address){
+			drivers[i].name = name;
+			return true;
+		}
+	}
+	if(amountOfDrivers >= maxDrivers){
+		return false;
+	}
+	drivers[amountOfDrivers].name = name;
+	drivers[amountOfDrivers].address = address;
+	amountOfDrivers++;
+	return true;
+}
+
+/// \brief
+/// Enable Tracing
+/// \details
+/// This function enables (true) or disables (false) the tracing. When disabled, the only overhead left is one
+/// comparison per byte.
+void busTracer::enable(const bool enable){
+	enabled = enable;
+	expectAddress = false;
+}
+
+/// \brief
+/// Is Enabled
+/// \details
+/// This function returns true if the traffic is being traced.
+bool busTracer::isEnabled(){
+	return enabled;
+}
+
+/// \brief
+/// Reset Statistics
+/// \details
+/// This function clears all counters and histograms. The names and addresses of the drivers are kept.
+void busTracer::resetStatistics(){
+	for(unsigned int i = 0; i < amountOfDrivers; i++){
+		auto name = drivers[i].name;
+		auto address = drivers[i].address;
+		drivers[i] = traceStatistics();
+		drivers[i].name = name;
+		drivers[i].address = address;
+	}
+	for(unsigned int i = 0; i < amountOfFunctions; i++){
+		auto name = functions[i].name;
+		functions[i] = traceStatistics();
+		functions[i].name = name;
+	}
+}
+
+/// \brief
+/// Print Entry
+/// \details
+/// This function prints one line of statistics followed by its histogram.
+void busTracer::printEntry(hwlib::ostream & stream, const traceStatistics & statistics){
+	if(statistics.name != nullptr){
+		stream << hwlib::left << hwlib::setw(24) << statistics.name;
+	} else {
+		stream << hwlib::left << "Address " << hwlib::setw(16) << unsigned(statistics.address);
+	}
+	stream << hwlib::setw(8) << statistics.calls << hwlib::setw(8) << statistics.transactions << hwlib::setw(8) << statistics.bytes
+		<< hwlib::setw(12) << unsigned(statistics.busTime) << hwlib::setw(12) << unsigned(statistics.blockedTime) << "|";
+	for(auto amount : statistics.histogram){
+		stream << hwlib::right << hwlib::setw(6) << amount;
+	}
+	stream << hwlib::endl;
+}
+
+/// \brief
+/// Print Statistics
+/// \details
+/// This function prints the statistics per driver and per calling function to the given stream. Times are in
+/// microseconds. The histogram columns are the buckets from < 100us up to >= 50ms.
+void busTracer::printStatistics(hwlib::ostream & stream){
+	stream << hwlib::left << hwlib::setw(24) << "Driver / Function" << hwlib::setw(8) << "Calls" << hwlib::setw(8) << "Trans"
+		<< hwlib::setw(8) << "Bytes" << hwlib::setw(12) << "Bus (us)" << hwlib::setw(12) << "Blocked" << "|"
+		<< hwlib::right << hwlib::setw(6) << "<100u" << hwlib::setw(6) << "<250u" << hwlib::setw(6) << "<500u"
+		<< hwlib::setw(6) << "<1m" << hwlib::setw(6) << "<2.5m" << hwlib::setw(6) << "<5m" << hwlib::setw(6) << "<10m"
+		<< hwlib::setw(6) << "<25m" << hwlib::setw(6) << "<50m" << hwlib::setw(6) << ">50m" << hwlib::endl;
+	for(unsigned int i = 0; i < amountOfDrivers; i++){
+		printEntry(stream, drivers[i]);
+	}
+	stream << hwlib::endl;
+	for(unsigned int i = 0; i < amountOfFunctions; i++){
+		printEntry(stream, functions[i]);
+	}
+}
+
+//<<<------------------------------------------------------------------------------------------->>>
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has three mandatory parameters; the tracer, the name of the driver and the name of the calling
+/// function. From now on, all traffic is counted for this driver and function.
+busTraceScope::busTraceScope(busTracer & tracer, const char * driver, const char * function):
+	tracer(tracer),
+	previousDriver(tracer.scopeDriver),
+	previousFunction(tracer.scopeFunction),
+	function(-1),
+	start(hwlib::now_us()),
+	previousChildTime(tracer.scopeChildTime)
+{
+	tracer.scopeChildTime = 0;
+	for(unsigned int i = 0; i < tracer.amountOfFunctions; i++){
+		if(busTracer::sameName(tracer.functions[i].name, function)){
+			this->function = i;
+		}
+	}
+	if(this->function < 0 && tracer.amountOfFunctions < busTracer::maxFunctions){
+		this->function = tracer.amountOfFunctions++;
+		tracer.functions[this->function].name = function;
+	}
+	tracer.scopeDriver = driver;
+	tracer.scopeFunction = this->function;
+}
+
+/// \brief
+/// Destructor
+/// \details
+/// The time this scope existed, minus the time of the scopes nested in it, is counted as blocked time for the
+/// function and driver; then the previous driver and function are restored. The whole time is added to the nested
+/// time of the enclosing scope, so it isn't counted twice.
+busTraceScope::~busTraceScope(){
+	const uint_fast64_t duration = hwlib::now_us() - start;
+	if(tracer.enabled){
+		const uint_fast64_t blocked = (duration > tracer.scopeChildTime) ? duration - tracer.scopeChildTime : 0;
+		if(function >= 0){
+			tracer.functions[function].calls++;
+			tracer.functions[function].blockedTime += blocked;
+			busTracer::count(tracer.functions[function], blocked);
+		}
+		auto driver = (tracer.scopeDriver != nullptr) ? tracer.findDriver(tracer.scopeDriver) : nullptr;
+		if(driver != nullptr){
+			driver->calls++;
+			driver->blockedTime += blocked;
+		}
+	}
+	tracer.scopeDriver = previousDriver;
+	tracer.scopeFunction = previousFunction;
+	tracer.scopeChildTime = previousChildTime + duration;
+}
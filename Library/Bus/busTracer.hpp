@@ -0,0 +1,134 @@
+/// @file
+
+#ifndef __BUS_TRACER_HPP
+#define __BUS_TRACER_HPP
+
+/// \brief
+/// Trace Statistics
+/// \details
+/// This struct contains the statistics kept for one driver or one calling function; the amount of
+/// transactions and bytes, the time the bus was busy and the time the caller was blocked. Durations are
+/// also counted in a fixed-bucket histogram; see busTracer for the bucket limits.
+///
+/// Used internally by busTracer.
+struct traceStatistics{
+	static constexpr unsigned int buckets = 10;
+	const char * name = nullptr;
+	uint8_t address = 0;
+	unsigned int calls = 0;
+	unsigned int transactions = 0;
+	unsigned int bytes = 0;
+	uint_fast64_t busTime = 0;
+	uint_fast64_t blockedTime = 0;
+	unsigned int histogram[buckets] = {};
+};
+
+/// \brief
+/// Bus Tracer
+/// \details
+/// This is a bit-banged I2C bus that keeps track of all traffic that passes through it. Since it is a
+/// hwlib::i2c_bus_bit_banged_scl_sda, it can be passed to every driver in place of the normal bus.
+/// Every transaction is counted, together with its bytes and duration, for the driver it belongs to. The
+/// driver is found by the I2C address, unless a busTraceScope says otherwise (the RDA5807 and its
+/// radioDataSystem share an address for example). Durations are put in histograms with the buckets:
+/// < 100us, < 250us, < 500us, < 1ms, < 2.5ms, < 5ms, < 10ms, < 25ms, < 50ms and >= 50ms.
+///
+/// A busTraceScope also registers the calling function. The time spent within a scope, including waits
+/// inside the driver, is counted as blocked time for that function. The time of a scope that is nested
+/// in another one is only counted for the inner scope, so the blocked times can be added up.
+///
+///	All supported operations are:
+///		- Add Driver
+///		- Enable/Disable Tracing
+///		- Print Statistics (with Histograms)
+///		- Reset Statistics
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto scl = target::pin_oc( target::pins::d8 );
+/// auto sda = target::pin_oc( target::pins::d9 );
+/// auto i2c_bus = busTracer(scl, sda);
+/// i2c_bus.addDriver("RDA5807", 0x10);
+/// i2c_bus.addDriver("RDA5807", 0x11);
+/// i2c_bus.addDriver("DS3231", 0x68);
+///
+/// auto radio = RDA5807(i2c_bus);
+/// auto clock = DS3231(i2c_bus);
+/// {
+/// 	auto scope = busTraceScope(i2c_bus, "radioDataSystem", "update");
+/// 	radio.radioData.update();
+/// }
+/// clock.getTime();
+/// i2c_bus.printStatistics(hwlib::cout);
+/// ~~~~~~~~~~~~~~~
+class busTracer : public hwlib::i2c_bus_bit_banged_scl_sda {
+	private:
+		static constexpr unsigned int maxDrivers = 8;
+		static constexpr unsigned int maxFunctions = 16;
+		std::array<traceStatistics, maxDrivers> drivers = {};
+		std::array<traceStatistics, maxFunctions> functions = {};
+		unsigned int amountOfDrivers = 0;
+		unsigned int amountOfFunctions = 0;
+		bool enabled = true;
+
+		//Current transaction
+		bool expectAddress = false;
+		uint_fast64_t transactionStart = 0;
+		unsigned int transactionBytes = 0;
+		uint8_t transactionAddress = 0;
+
+		//Current scope
+		const char * scopeDriver = nullptr;
+		int scopeFunction = -1;
+		uint_fast64_t scopeChildTime = 0;		//Time spent in scopes nested in the current one
+
+		static bool sameName(const char * first, const char * second);
+		static void count(traceStatistics & statistics, const uint_fast64_t duration);
+		traceStatistics & findDriver(const uint8_t address);
+		traceStatistics * findDriver(const char * name);
+		void printEntry(hwlib::ostream & stream, const traceStatistics & statistics);
+
+		friend class busTraceScope;
+	public:
+		busTracer(hwlib::pin_oc & scl, hwlib::pin_oc & sda);
+
+		void write_start() override;
+		void write_stop() override;
+		void write_byte(uint8_t x) override;
+		uint8_t read_byte() override;
+
+		bool addDriver(const char * name, const uint8_t address);
+		void enable(const bool enable = true);
+		bool isEnabled();
+
+		void resetStatistics();
+		void printStatistics(hwlib::ostream & stream);
+};
+
+/// \brief
+/// Bus Trace Scope
+/// \details
+/// This is a class that tells a busTracer which driver and function are responsible for the traffic
+/// while the object exists. When the object goes out of scope the previous driver and function are
+/// restored, so scopes can be nested. The time the object existed is counted as blocked time, minus the
+/// time of the scopes nested in it; those are counted for their own function and driver.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// {
+/// 	auto scope = busTraceScope(i2c_bus, "RDA5807", "signalStrength");
+/// 	strength = radio.signalStrength();
+/// }
+/// ~~~~~~~~~~~~~~~
+class busTraceScope{
+	private:
+		busTracer & tracer;
+		const char * previousDriver;
+		int previousFunction;
+		int function;
+		uint_fast64_t start;
+		uint_fast64_t previousChildTime;
+	public:
+		busTraceScope(busTracer & tracer, const char * driver, const char * function);
+		~busTraceScope();
+};
+
+#endif //__BUS_TRACER_HPP
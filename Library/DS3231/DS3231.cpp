@@ -87,24 +87,35 @@ void DS3231::setData(){
 	transaction.write(data, 8);
 }
 
+/// \brief
+/// BCD to Decimal
+/// \details
+/// This function returns the decimal value of the given binary coded decimal; two digits of 4 bits each.
+uint8_t DS3231::fromBcd(const uint8_t value){
+	return (value >> 4) * 10 + (value & 0x0F);
+}
+
+/// \brief
+/// Decimal to BCD
+/// \details
+/// This function returns the given value (0 up to 99) as binary coded decimal.
+uint8_t DS3231::toBcd(const unsigned int value){
+	return ((value / 10) << 4) | (value % 10);
+}
+
 /// \brief
 /// Get Status
 /// \details
-/// This function gets and stores all neccesary data from the DS3231 to retrieve the time and date.
+/// This function gets and stores all neccesary data from the DS3231 to retrieve the time and date. The seven time and date
+/// registers are read with one burst read; the chip copies them to a buffer at the start of the read, so they always
+/// belong to the same second. There is no need to wait afterwards.
 void DS3231::getStatus(){
 	bus.write(address).write(0x00);
 	auto transaction = bus.read(address);
 	transaction.read(status, 7);
-	hwlib::wait_ms(30);
 
-	time.setSeconds((status[0] & 0x0F) + ((status[0] >> 4) & 0x07) * 10);
-	time.setMinutes(((status[1] & 0x0F) + ((status[1] >> 4) & 0x07) * 10));
-	time.setHours((status[2] & 0x0F) + ((status[2] >> 4) * 10) + (status[2] >> 5) * 20);
-
-	date.setWeekDay(status[3] & 0x07);
-	date.setMonthDay((status[4] & 0x0F) + (((status[4] >> 4) & 0x03) * 10));
-	date.setMonth(((status[5] & 0x0F) + ((status[5] >> 4) & 0x01) * 10));
-	date.setYear(((status[6] & 0x0F) + (((status[6] >> 4) & 0x0F) * 10) + (2000 - (100 * (status[5] >> 7 & 1)))));
+	time.setTime(fromBcd(status[2] & 0x3F), fromBcd(status[1] & 0x7F), fromBcd(status[0] & 0x7F));		//24 hour mode
+	date.setDate(status[3] & 0x07, fromBcd(status[4] & 0x3F), fromBcd(status[5] & 0x1F), fromBcd(status[6]) + (2000 - (100 * (status[5] >> 7 & 1))));
 }
 
 /// \brief
@@ -183,6 +194,17 @@ dateData DS3231::getDate(){
 	return date;
 }
 
+/// \brief
+/// Get Time and Date
+/// \details
+/// This function fills the given time and date with one read. Calling getTime() and getDate() after each other reads
+/// the same registers twice.
+void DS3231::getTimeDate(timeData & currentTime, dateData & currentDate){
+	getStatus();
+	currentTime = time;
+	currentDate = date;
+}
+
 /// \brief
 /// Set First Alarm
 /// \details
@@ -192,28 +214,76 @@ dateData DS3231::getDate(){
 ///		- 14 (alarm when seconds match; so at least once per minute)
 ///		- 12 (alarm when minutes and seconds match; so at least once an hour)
 /// 	- 8 (alarm when hours, minutes and seconds match)
-///		- 0 (alarm when weekDay, hours, minutes and seconds match)
-///		- 16 (alarm when monthDay, hours, minutes and seconds match. 16 to enable easy and fast bit operation)
-/// When the outputSignal boolean is true (which it doesn't default to) the SQW output becomes high when the signal is triggered. The alarm-trigger-bit remains high
-/// though; it can be checked later. Unless the bit is cleared with clearAlarm(). For the made changes to have effect, setSecondAlarm() has also
-/// got to be called.
+///		- 0 (alarm when weekDay or monthDay, hours, minutes and seconds match)
+/// Bit n of the match conditions is the mask bit (A1Mn + 1) of register n of the alarm. When dateCondition is true, the day of the
+/// week has to match; otherwise the day of the month. When the outputSignal boolean is true (which it doesn't default to) the
+/// INT/SQW output becomes low when the alarm is triggered; see enableAlarmInterrupts(). The alarm-trigger-bit remains high
+/// though; it can be checked later. Unless the bit is cleared with clearAlarm().
 void DS3231::setFirstAlarm(const unsigned int matchConditions, const bool dateCondition, const bool outputSignal){
 	clearAlarm(1);
 	firstAlarm.enableOutputSignal(outputSignal);
 	firstAlarm.setMatchConditions(matchConditions);
-	auto transaction = bus.write(address);
-	transaction.write(0x07);		//0x07 for ALARM1, 0x11 for ALARM2
-	transaction.write((((firstAlarm.time.getSeconds() / 10) & 0x07) << 4) + ((firstAlarm.time.getSeconds() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x01) << 7));
-	transaction.write((((firstAlarm.time.getMinutes() / 10) & 0x07) << 4) + ((firstAlarm.time.getMinutes() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x02) << 6));
-	transaction.write((((firstAlarm.time.getHours() / 10) & 0x01) << 4) + ((firstAlarm.time.getHours() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x03) << 5));
-	if(dateCondition){
-		//If the Day of Week has to match, 1 has to be written to 6th bit and weekDay has to be written as well.
-		transaction.write((firstAlarm.date.getWeekDay() & 0x0F) + ((firstAlarm.getMatchConditions() & 0x04) << 4) + (((dateCondition) & 1) << 6));
-	} else {
-		transaction.write((((firstAlarm.date.getMonthDay() / 10) & 0x03) << 4) + ((firstAlarm.date.getMonthDay() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x04) << 4) + (((dateCondition) & 1) << 6));
+	{
+		auto transaction = bus.write(address);
+		transaction.write(0x07);		//0x07 for ALARM1, 0x0B for ALARM2
+		transaction.write(toBcd(firstAlarm.time.getSeconds()) | ((matchConditions & 0x01) << 7));
+		transaction.write(toBcd(firstAlarm.time.getMinutes()) | ((matchConditions & 0x02) << 6));
+		transaction.write(toBcd(firstAlarm.time.getHours()) | ((matchConditions & 0x04) << 5));
+		if(dateCondition){
+			transaction.write((firstAlarm.date.getWeekDay() & 0x07) | ((matchConditions & 0x08) << 4) | (1 << 6));
+		} else {
+			transaction.write(toBcd(firstAlarm.date.getMonthDay()) | ((matchConditions & 0x08) << 4));
+		}
+	}
+	if(outputSignal){
+		enableAlarmInterrupts(true, (getControl() >> 1) & 1);
+	}
+}
+
+/// \brief
+/// Get Control Register
+/// \details
+/// This function reads and returns the control register (0x0E); EOSC, BBSQW, CONV, RS2, RS1, INTCN, A2IE and A1IE
+/// from the most to the least significant bit.
+uint8_t DS3231::getControl(){
+	bus.write(address).write(0x0E);
+	return bus.read(address).read_byte();
+}
+
+/// \brief
+/// Update Control Register
+/// \details
+/// This function changes the bits of the control register that are set in the mask to the given value. The other
+/// bits are kept. Nothing is written when nothing changes.
+void DS3231::updateControl(const uint8_t mask, const uint8_t value){
+	const uint8_t control = getControl();
+	const uint8_t updated = (control & ~mask) | (value & mask);
+	if(updated != control){
+		auto transaction = bus.write(address);
+		transaction.write(0x0E);
+		transaction.write(updated);
 	}
 }
 
+/// \brief
+/// Set Square Wave
+/// \details
+/// This function makes the INT/SQW pin output a square wave of the given frequency; see squareWaveFrequency. It defaults
+/// to 1Hz, of which the falling edge is the start of a new second. The alarms can't pull the pin low anymore, but their
+/// flags are still set. When batteryBacked is true, the square wave continues while the chip runs on its battery.
+void DS3231::setSquareWave(const uint8_t frequency, const bool batteryBacked){
+	updateControl(0x5C, (batteryBacked << 6) | ((frequency & 0x03) << 3));		//BBSQW, RS2, RS1 and INTCN cleared
+}
+
+/// \brief
+/// Enable Alarm Interrupts
+/// \details
+/// This function makes the INT/SQW pin an active-low interrupt output (INTCN); the square wave stops. The pin becomes
+/// low when an enabled alarm triggers and stays low until its flag has been cleared with clearAlarm().
+void DS3231::enableAlarmInterrupts(const bool first, const bool second){
+	updateControl(0x07, 0x04 | (second << 1) | first);
+}
+
 /// \brief
 /// Change First Alarm Time
 /// \details
@@ -230,29 +300,33 @@ void DS3231::changeFirstAlarm(const timeData & alarmTime, const dateData & alarm
 /// Set Second Alarm
 /// \details
 /// This function enables the alarm at the time set by calling the function changeSecondAlarm(). The matchconditions determine when
-/// the alarm should be triggered. The available conditions are:
+/// the alarm should be triggered. The second alarm has no seconds; it triggers at the start of the minute. The available conditions are:
 ///		- 7 (alarm once per minute)
 ///		- 6 (alarm when minutes match)
-/// 	- 8 (alarm when hours and minutes)
-///		- 0 (alarm when weekDay, hours and minutes match)
-///		- 16 (alarm when monthDay, hours and minutes match)
-/// When the outputSignal boolean is true (which it doesn't default to) the SQW output becomes high when the signal is triggered.
-/// Depending on the match conditions, the alarm should be checked every second, minute, hour or day. The alarm-trigger-bit remains high
-/// though; it can be checked later. Unless the bit is cleared with clearAlarm(). For the made changes to have effect, setFirstAlarm() has also
-/// got to be called.
+/// 	- 4 (alarm when hours and minutes match)
+///		- 0 (alarm when weekDay or monthDay, hours and minutes match)
+/// Bit n of the match conditions is the mask bit (A2Mn + 2) of register n of the alarm. When dateCondition is true, the day of the
+/// week has to match; otherwise the day of the month. When the outputSignal boolean is true (which it doesn't default to) the
+/// INT/SQW output becomes low when the alarm is triggered; see enableAlarmInterrupts(). Depending on the match conditions, the
+/// alarm should be checked every minute, hour or day. The alarm-trigger-bit remains high though; it can be checked later. Unless
+/// the bit is cleared with clearAlarm().
 void DS3231::setSecondAlarm(const unsigned int matchConditions, const bool dateCondition, const bool outputSignal){
 	clearAlarm(2);
 	secondAlarm.enableOutputSignal(outputSignal);
 	secondAlarm.setMatchConditions(matchConditions);
-	auto transaction = bus.write(address);
-	transaction.write(0x11);		//0x07 for ALARM1, 0x11 for ALARM2
-	transaction.write((((secondAlarm.time.getSeconds() / 10) & 0x07) << 4) + ((secondAlarm.time.getSeconds() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x01) << 7));
-	transaction.write((((secondAlarm.time.getMinutes() / 10) & 0x07) << 4) + ((secondAlarm.time.getMinutes() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x02) << 6));
-	transaction.write((((secondAlarm.time.getHours() / 10) & 0x01) << 4) + ((secondAlarm.time.getHours() % 10) & 0x0F)  + ((secondAlarm.getMatchConditions() & 0x03) << 5));
-	if(dateCondition){
-		transaction.write((secondAlarm.date.getWeekDay() & 0x0F)  + ((secondAlarm.getMatchConditions() & 0x04) << 4) + (((dateCondition) & 1) << 6));
-	} else {
-		transaction.write((((secondAlarm.date.getMonthDay() / 10) & 0x03) << 4) + ((secondAlarm.date.getMonthDay() % 10) & 0x0F) + ((secondAlarm.getMatchConditions() & 0x04) << 4) + (((dateCondition) & 1) << 6));
+	{
+		auto transaction = bus.write(address);
+		transaction.write(0x0B);		//0x07 for ALARM1, 0x0B for ALARM2
+		transaction.write(toBcd(secondAlarm.time.getMinutes()) | ((matchConditions & 0x01) << 7));
+		transaction.write(toBcd(secondAlarm.time.getHours()) | ((matchConditions & 0x02) << 6));
+		if(dateCondition){
+			transaction.write((secondAlarm.date.getWeekDay() & 0x07) | ((matchConditions & 0x04) << 5) | (1 << 6));
+		} else {
+			transaction.write(toBcd(secondAlarm.date.getMonthDay()) | ((matchConditions & 0x04) << 5));
+		}
+	}
+	if(outputSignal){
+		enableAlarmInterrupts(getControl() & 1, true);
 	}
 }
 
@@ -64,6 +64,17 @@ class alarm{
 		dateData date;
 };
 
+/// \brief
+/// Square Wave Frequency
+/// \details
+/// These are the frequencies the INT/SQW pin of the DS3231 can output; see DS3231::setSquareWave().
+namespace squareWaveFrequency{
+	constexpr uint8_t hz1 = 0;
+	constexpr uint8_t hz1024 = 1;
+	constexpr uint8_t hz4096 = 2;
+	constexpr uint8_t hz8192 = 3;
+}
+
 /// \brief
 /// DS3231 Interface
 /// \details
@@ -76,6 +87,7 @@ class alarm{
 ///		- Get Date
 ///		- Set Alarm
 ///		- Unset Alarm
+///		- Square Wave Output or Alarm Interrupts (control register)
 /// 	- Get Temperature
 ///
 /// ~~~~~~~~~~~~~~~{.cpp}
@@ -119,6 +131,9 @@ class DS3231{
 		uint8_t status[13] = {};
 		void setData();
 		void getStatus();
+		static uint8_t fromBcd(const uint8_t value);
+		static uint8_t toBcd(const unsigned int value);
+		void updateControl(const uint8_t mask, const uint8_t value);
 
 		bool firstAlarmState = false;
 		bool secondAlarmState = false;
@@ -138,6 +153,7 @@ class DS3231{
 
 		timeData getTime();
 		dateData getDate();
+		void getTimeDate(timeData & currentTime, dateData & currentDate);
 
 		void changeFirstAlarm(const timeData & alarmTime, const dateData & alarmDate);
 		void setFirstAlarm(const unsigned int matchConditions, const bool dateCondition = true, const bool outputSignal = false);
@@ -149,6 +165,10 @@ class DS3231{
 		unsigned int checkAlarms();
 		void clearAlarm(const unsigned int alarmNumber);
 
+		uint8_t getControl();
+		void setSquareWave(const uint8_t frequency = squareWaveFrequency::hz1, const bool batteryBacked = false);
+		void enableAlarmInterrupts(const bool first = true, const bool second = true);
+
 		void setReset(const bool reset = true);
 		bool getReset();
 
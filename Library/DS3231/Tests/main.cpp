@@ -2,11 +2,19 @@
 
 #include "hwlib.hpp"
 #include "DS3231.hpp"
+#include "clockService.hpp"
+#include "RDA5807.hpp"
+#include "A24C256.hpp"
+#include "keyValueStore.hpp"
+#include "presetStore.hpp"
+#include "alarmClock.hpp"
+#include "menu.hpp"
 
 /// \brief
 /// Test
 /// \details
-/// This program tests most of the functionality of the DS3231 Real Time clock.
+/// This program tests most of the functionality of the DS3231 Real Time clock and the alarm clock built on it. The
+/// RDA5807 and A24C256 of the radio have to be on the bus as well.
 int main( void ){
   namespace target = hwlib::target;
 
@@ -130,6 +138,66 @@ int main( void ){
     hwlib::wait_ms(3000);
   }
   hwlib::cout << hwlib::endl;
+
+  auto wallClock = clockService(clock);
+  timeData burstTime;
+  dateData burstDate;
+  clock.getTimeDate(burstTime, burstDate);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Burst read equals separate reads: " << (burstDate == clock.getDate() && clock.getTime() - burstTime <= timeData(0, 0, 1)) << hwlib::endl;
+  wallClock.synchronize(hwlib::now_us() / 1000);
+  hwlib::wait_ms(2500);
+  auto counted = wallClock.getTime(hwlib::now_us() / 1000);
+  auto read = clock.getTime();
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Counted time follows the chip: " << (read - counted <= timeData(0, 0, 1) || counted - read <= timeData(0, 0, 1)) << hwlib::endl;
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Chip is only read on a new minute: " << (wallClock.getSynchronizations() == ((counted.getSeconds() < 3) ? 2u : 1u)) << hwlib::endl << hwlib::endl;
+
+  clock.setSquareWave(squareWaveFrequency::hz4096);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Square wave frequency is set: " << ((clock.getControl() & 0x1C) == 0x10) << hwlib::endl;
+  clock.enableAlarmInterrupts(true, false);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Alarm interrupts are enabled: " << ((clock.getControl() & 0x07) == 0x05) << hwlib::endl;
+  clock.setSquareWave();
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Square wave replaces the interrupts: " << ((clock.getControl() & 0x1C) == 0x00) << hwlib::endl;
+  clock.setFirstAlarm(15);        //Once per second; triggers before the interrupt is used
+  hwlib::wait_ms(1100);
+  wallClock.useAlarmInterrupt(false, false);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Stale alarms are cleared, not reported: " << (clock.checkAlarms() == 0 && wallClock.takeAlarms() == 0) << hwlib::endl;
+  clock.setSquareWave();
+  hwlib::cout << hwlib::endl;
+
+  hwlib::cout << "------------------------------ALARM CLOCK---------------------------" << hwlib::endl << hwlib::endl;
+  auto memory = A24C256(i2c_bus);
+  auto settings = keyValueStore(memory, 4096, 1024);
+  settings.mount();
+  auto presets = presetStore(memory);
+  presets.load();
+  auto radio = RDA5807(i2c_bus);
+  radio.begin();
+  radio.setVolume(5);
+  auto radioAlarm = alarmClock(radio, presets, clock, settings, 9, 0);      //Own key and no time between the steps
+  wakeUpSettings wakeUp;
+  wakeUp.enabled = true;
+  wakeUp.hours = 6;
+  wakeUp.minutes = 45;
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Wake-up enables the first alarm: " << (radioAlarm.setWakeUp(wakeUp) && (clock.getControl() & 0x07) == 0x05) << hwlib::endl;
+  auto reloadedAlarm = alarmClock(radio, presets, clock, settings, 9, 0);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Wake-up is kept in the store: " << (reloadedAlarm.load() && reloadedAlarm.getWakeUp().enabled && reloadedAlarm.getWakeUp().hours == 6 && reloadedAlarm.getWakeUp().minutes == 45) << hwlib::endl;
+  radioAlarm.startSleepTimer(clock.getTime(), 30);
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Sleep timer enables the second alarm: " << (radioAlarm.sleepTimerRunning() && (clock.getControl() & 0x07) == 0x07) << hwlib::endl;
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Sleep timer starts fading out: " << (radioAlarm.handle(2, 0) && radioAlarm.getState() == alarmState::fadingOut) << hwlib::endl;
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Second alarm is disabled afterwards: " << (!radioAlarm.sleepTimerRunning() && (clock.getControl() & 0x07) == 0x05) << hwlib::endl;
+  while(radioAlarm.step(0)){}
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Radio is asleep after fading out: " << (radioAlarm.isAsleep() && radio.isStandBy()) << hwlib::endl;
+  radioAlarm.wake();
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Waking restores the volume: " << (!radio.isStandBy() && radio.getVolume() == 5) << hwlib::endl;
+
+  auto scanner = bandScanner(radio);
+  auto navigation = menu(radio, presets, scanner);
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::turnCounterClockwise, 1});
+  navigation.handle(gestureEvent{gestureType::longPress, 1});
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Long-press in Area 7 requests the wake-up: " << (navigation.getArea() == 7 && navigation.wakeUpRequested() && !navigation.presetRequested()) << hwlib::endl;
+  wakeUp.enabled = false;
+  hwlib::cout << hwlib::left << hwlib::setw(45) << "Clearing the wake-up disables alarm 1: " << (radioAlarm.setWakeUp(wakeUp) && (clock.getControl() & 0x07) == 0x04) << hwlib::endl << hwlib::endl;
   
   //Uncomment if time is allowed to get lost. You'll have to set it again later.
   //hwlib::cout << hwlib::left << hwlib::setw(45) << "Set time to 0:0:0 : ";
@@ -0,0 +1,185 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "clockService.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the DS3231. Nothing is read until the first poll(), synchronize()
+/// or getTime().
+clockService::clockService(DS3231 & clock):
+	clock(clock)
+{}
+
+/// \brief
+/// Elapsed Seconds
+/// \details
+/// This function returns the amount of whole seconds that have passed since the anchor, according to the local clock.
+unsigned int clockService::elapsedSeconds(const uint_fast64_t now){
+	return (now > anchor) ? (now - anchor) / 1000 : 0;
+}
+
+/// \brief
+/// Synchronize
+/// \details
+/// This function reads the time and date from the DS3231 with one burst read. The given moment (in milliseconds) is the
+/// moment the read time belongs to. Unless the alarms signal themselves through the INT/SQW pin, their flags are read
+/// as well.
+void clockService::synchronize(const uint_fast64_t now){
+	clock.getTimeDate(time, date);
+	if(!alarmInterrupt){
+		readAlarms();
+	}
+	anchor = now;
+	synchronized = true;
+	synchronizations++;
+}
+
+/// \brief
+/// Poll
+/// \details
+/// This function has to be called regularly with the current moment (in milliseconds). Only when the counted seconds
+/// reach the next minute (or nothing has been read yet), the DS3231 is read; otherwise nothing happens. It returns true
+/// when the time has been read, so the minute has changed.
+bool clockService::poll(const uint_fast64_t now){
+	if(!synchronized || time.getSeconds() + elapsedSeconds(now) >= 60){
+		synchronize(now);
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Second Edge
+/// \details
+/// This function has to be called on the falling edge of the 1Hz square wave; the moment the DS3231 starts a new second.
+/// The second is counted and the local clock is only used within the second. At the edge of the new minute, the DS3231
+/// is read; then true is returned.
+bool clockService::secondEdge(const uint_fast64_t now){
+	edges++;
+	if(!synchronized || time.getSeconds() + 1 >= 60){
+		synchronize(now);
+		return true;
+	}
+	time.setSeconds(time.getSeconds() + 1);
+	anchor = now;
+	return false;
+}
+
+/// \brief
+/// Read Alarms
+/// \details
+/// This function reads the alarm flags, adds the triggered alarms to the ones that haven't been taken yet and clears
+/// their flags, so the INT/SQW pin is released.
+void clockService::readAlarms(){
+	const unsigned int triggered = clock.checkAlarms();
+	if(triggered & 1){
+		clock.clearAlarm(1);
+	}
+	if(triggered & 2){
+		clock.clearAlarm(2);
+	}
+	alarms |= triggered;
+}
+
+/// \brief
+/// Use Square Wave
+/// \details
+/// This function makes the DS3231 output the 1Hz square wave on its INT/SQW pin; sample() counts the seconds with it.
+void clockService::useSquareWave(){
+	clock.setSquareWave(squareWaveFrequency::hz1);
+	squareWave = true;
+	alarmInterrupt = false;
+}
+
+/// \brief
+/// Use Alarm Interrupt
+/// \details
+/// This function makes the INT/SQW pin of the DS3231 go low when one of the given alarms triggers; sample() reads the
+/// alarm flags only then. The seconds are counted with the local clock. Alarms that triggered before (while the radio
+/// was off) are cleared without being reported; otherwise they would keep the pin low and be handled as new alarms.
+void clockService::useAlarmInterrupt(const bool first, const bool second){
+	clock.enableAlarmInterrupts(first, second);
+	squareWave = false;
+	alarmInterrupt = true;
+	const unsigned int stale = clock.checkAlarms();
+	if(stale & 1){
+		clock.clearAlarm(1);
+	}
+	if(stale & 2){
+		clock.clearAlarm(2);
+	}
+	alarms = 0;
+}
+
+/// \brief
+/// Sample INT/SQW Pin
+/// \details
+/// This function is given the level of the INT/SQW pin and the current moment (in milliseconds). It only acts on a
+/// falling edge; a new second in square wave mode or a triggered alarm in alarm interrupt mode. Between edges it costs
+/// no I2C traffic. It returns true when the minute changed or an alarm has been triggered.
+bool clockService::sample(const bool level, const uint_fast64_t now){
+	const bool falling = lastLevel && !level;
+	lastLevel = level;
+	if(!falling){
+		return false;
+	}
+	if(squareWave){
+		return secondEdge(now);
+	}
+	if(alarmInterrupt){
+		edges++;
+		readAlarms();
+		lastLevel = true;		//The pin has been released by clearing the flags
+		return alarms != 0;
+	}
+	return false;
+}
+
+/// \brief
+/// Take Triggered Alarms
+/// \details
+/// This function returns the alarms that have been triggered since the last call; bit 0 for the first and bit 1 for
+/// the second alarm. They are forgotten afterwards.
+unsigned int clockService::takeAlarms(){
+	const unsigned int triggered = alarms;
+	alarms = 0;
+	return triggered;
+}
+
+/// \brief
+/// Get Time
+/// \details
+/// This function returns the current time; the time that has been read plus the seconds that have been counted since.
+/// The DS3231 is only read when the minute has changed.
+timeData clockService::getTime(const uint_fast64_t now){
+	poll(now);
+	auto current = time;
+	current.setSeconds(time.getSeconds() + elapsedSeconds(now));
+	return current;
+}
+
+/// \brief
+/// Get Date
+/// \details
+/// This function returns the date as it has been read at the last synchronization. It never touches the bus.
+dateData clockService::getDate(){
+	return date;
+}
+
+/// \brief
+/// Get Amount of Synchronizations
+/// \details
+/// This function returns how often the DS3231 has been read since construction.
+unsigned int clockService::getSynchronizations(){
+	return synchronizations;
+}
+
+/// \brief
+/// Get Amount of Edges
+/// \details
+/// This function returns how often secondEdge() has been called since construction.
+unsigned int clockService::getEdges(){
+	return edges;
+}
@@ -0,0 +1,86 @@
+/// @file
+
+#ifndef __CLOCK_SERVICE_HPP
+#define __CLOCK_SERVICE_HPP
+
+#include "DS3231.hpp"
+
+/// \brief
+/// Clock Service
+/// \details
+/// This is a wall clock on top of a DS3231 of which asking the time costs no I2C traffic. The time and date are read
+/// once with one burst read; from then on the seconds are counted with the local clock of the microcontroller. Only when
+/// the counted time reaches the next minute, the DS3231 is read again, so the minutes, hours and date always come
+/// from the chip and the local clock can't drift away for more than a minute.
+///
+/// When the 1Hz square wave output of the DS3231 is connected, secondEdge() can be called on every falling edge; the chip
+/// starts a new second at that moment. The seconds are then counted by the edges instead of the local clock and the
+/// minute rollover is noticed exactly.
+///
+/// The INT/SQW pin can either output the square wave or signal the alarms; not both. useSquareWave() and
+/// useAlarmInterrupt() configure the chip for one of them and sample() is given the level of the pin; it finds the falling
+/// edges itself. In square wave mode the alarm flags are read together with every minute; in alarm interrupt mode they are
+/// only read when the pin goes low. Either way, nothing is sent over the bus in between. Triggered alarms are collected
+/// until takeAlarms() is called.
+///
+///	All supported operations are:
+///		- Synchronize (one burst read)
+///		- Poll (returns true when the minute changed)
+///		- Second Edge (1Hz square wave)
+///		- Use Square Wave or Alarm Interrupt
+///		- Sample INT/SQW Pin
+///		- Take Triggered Alarms
+///		- Get Time / Get Date (no I2C traffic)
+///		- Get Amount of Synchronizations
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto clock = DS3231(i2c_bus);
+/// auto wallClock = clockService(clock);
+/// auto interrupt = hwlib::target::pin_in(hwlib::target::pins::d42);
+/// wallClock.useAlarmInterrupt();
+/// for(;;){
+/// 	interrupt.refresh();
+/// 	wallClock.sample(interrupt.read(), hwlib::now_us() / 1000);
+/// 	if(wallClock.poll(hwlib::now_us() / 1000)){
+/// 		hwlib::cout << wallClock.getTime(hwlib::now_us() / 1000) << hwlib::endl;	//Once per minute
+/// 	}
+/// 	if(wallClock.takeAlarms() & 1){
+/// 		hwlib::cout << "First alarm!" << hwlib::endl;
+/// 	}
+/// }
+/// ~~~~~~~~~~~~~~~
+class clockService{
+	private:
+		DS3231 & clock;
+		timeData time;
+		dateData date;
+		uint_fast64_t anchor = 0;			//Moment (in ms) at which 'time' was read or its second started
+		bool synchronized = false;
+		unsigned int synchronizations = 0;
+		unsigned int edges = 0;
+		bool squareWave = false;
+		bool alarmInterrupt = false;
+		bool lastLevel = true;
+		unsigned int alarms = 0;
+		void readAlarms();
+		unsigned int elapsedSeconds(const uint_fast64_t now);
+	public:
+		clockService(DS3231 & clock);
+
+		void synchronize(const uint_fast64_t now);
+		bool poll(const uint_fast64_t now);
+		bool secondEdge(const uint_fast64_t now);
+
+		void useSquareWave();
+		void useAlarmInterrupt(const bool first = true, const bool second = true);
+		bool sample(const bool level, const uint_fast64_t now);
+		unsigned int takeAlarms();
+
+		timeData getTime(const uint_fast64_t now);
+		dateData getDate();
+
+		unsigned int getSynchronizations();
+		unsigned int getEdges();
+};
+
+#endif //__CLOCK_SERVICE_HPP
@@ -11,32 +11,66 @@
 /// to be connected; it then always returns 0. 
 KY040::KY040(hwlib::pin_in & CLK, hwlib::pin_in & DT, hwlib::pin_in & SW, const int posCounter, const bool swPress): CLK(CLK), DT(DT), SW(SW), posCounter(posCounter), swPress(swPress) {
 	CLK.refresh();
-	lastPos = CLK.read();
-	curPos = lastPos;
+	DT.refresh();
+	state = (CLK.read() << 1) | DT.read();
 }
 
 /// \brief
 /// Update readings
 /// \details
 /// This function determines the position of the encoder and checks wether the button is
-/// pressed. Since Rotary Encoders are completely time-based, this function has got to be
-/// called frequently enough for the values to be updated correctly (~10ms / ~80ms). The
-/// Rotary Encoder outputs a grey-code and this function tries to interpret that outputted
-/// code. It's very basic though.
+/// pressed. The previous and current state of CLK and DT (2 bits each) form the index in
+/// a table of all 16 possible transitions; a valid transition is a quarter step in either
+/// direction, no change or an impossible change (both pins at once) gives 0. When the encoder
+/// is back at rest (both pins high) after more than half a cycle in one direction, a step is counted.
+/// Bounces cancel out since they go back and forth.
 void KY040::update(){
+	static constexpr int8_t transitions[16] = {
+		 0, -1,  1,  0,
+		 1,  0,  0, -1,
+		-1,  0,  0,  1,
+		 0,  1, -1,  0
+	};
+	static constexpr uint8_t rest = 0b11;
 	CLK.refresh();
-	curPos = CLK.read();
-	if(curPos != lastPos){
-		DT.refresh();
-		if(DT.read() != curPos){
-			posCounter++;
-		} else {
-			posCounter--;
+	DT.refresh();
+	const uint8_t newState = (CLK.read() << 1) | DT.read();
+	if(newState != state){
+		const int8_t transition = transitions[(state << 2) | newState];
+		if(transition == 0){
+			invalidTransitions++;
+		}
+		quarterSteps += transition;
+		state = newState;
+		if(state == rest){
+			if(quarterSteps > 1){
+				step(1);
+			} else if(quarterSteps < -1){
+				step(-1);
+			}
+			quarterSteps = 0;
 		}
 	}
 	SW.refresh();
-	swPress = !SW.read();
-	lastPos = curPos;
+	swPress.store(!SW.read(), std::memory_order_relaxed);
+	updates++;
+}
+
+/// \brief
+/// Step
+/// \details
+/// This function counts one step in the given direction (1 or -1) and determines the velocity. The velocity is
+/// the average of the previous velocity and the speed of this step, and starts over when the direction changes.
+void KY040::step(const int direction){
+	posCounter.fetch_add(direction, std::memory_order_relaxed);
+	const unsigned int interval = updates - lastStepUpdate;
+	const int speed = direction * int(updateFrequency / ((interval > 0) ? interval : 1));
+	if((velocity > 0) == (direction > 0) && velocity != 0){
+		velocity = (velocity + speed) / 2;
+	} else {
+		velocity = direction;
+	}
+	lastStepUpdate = updates;
 }
 
 /// \brief
@@ -46,7 +80,7 @@ void KY040::update(){
 /// the update() function has got to be called often enough. Positions can be both, 
 /// negative (counter clockwise) and positive (clockwise).
 int KY040::getPos(){
-	return posCounter;
+	return posCounter.load(std::memory_order_relaxed);
 }
 
 /// \brief
@@ -55,7 +89,7 @@ int KY040::getPos(){
 /// This function can be used to set the position to a desired value. This way a new zero-
 /// point can be selected. Positions can be both, negative (counter clockwise) and positive (clockwise).
 void KY040::setPos(const int newPos){
-	posCounter = newPos;
+	posCounter.store(newPos, std::memory_order_relaxed);
 }
 
 /// \brief
@@ -65,7 +99,51 @@ void KY040::setPos(const int newPos){
 /// the value to be accurate and recent, the update() function has got te be called often
 /// enough.
 bool KY040::isPressed(){
-	return swPress;  
+	return swPress.load(std::memory_order_relaxed);
+}
+
+/// \brief
+/// Set Update Frequency
+/// \details
+/// This function sets the rate (in Hz) at which update() is called. It is needed to determine the velocity and
+/// defaults to 1000Hz.
+void KY040::setUpdateFrequency(const unsigned int frequency){
+	if(frequency > 0){
+		updateFrequency = frequency;
+	}
+}
+
+/// \brief
+/// Get Velocity
+/// \details
+/// This function returns the velocity in steps per second; positive is clockwise, negative counter clockwise.
+/// When there hasn't been a step for a quarter of a second, the encoder is standing still and 0 is returned.
+int KY040::getVelocity(){
+	if(updates - lastStepUpdate > updateFrequency / 4){
+		return 0;
+	}
+	return velocity;
+}
+
+/// \brief
+/// Get Step Size
+/// \details
+/// This function turns the velocity into a step size; 1 when turning slowly, growing with the square of the velocity
+/// (10 steps/s gives 2, 20 steps/s gives 5) up to maxStepSize, which defaults to 10.
+unsigned int KY040::getStepSize(const unsigned int maxStepSize){
+	const int current = getVelocity();
+	const unsigned int speed = (current < 0) ? -current : current;
+	const unsigned int stepSize = 1 + (speed * speed) / 100;
+	return (stepSize < maxStepSize) ? stepSize : maxStepSize;
+}
+
+/// \brief
+/// Get Invalid Transitions
+/// \details
+/// This function returns how many times both pins changed at once. This happens when the encoder bounces or update()
+/// isn't called often enough; a high amount means the update rate is too low.
+unsigned int KY040::getInvalidTransitions(){
+	return invalidTransitions;
 }
 
 /// \brief
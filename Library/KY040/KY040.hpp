@@ -3,18 +3,28 @@
 #ifndef __KY040_HPP
 #define __KY040_HPP
 
+#include <atomic>
+
 /// \brief
-/// Polling KY040 Rotary Encoder Interface
+/// KY040 Rotary Encoder Interface
 /// \details
 /// This is an interface that simplifies the use of the KY040 Rotary Encoder.
 /// This class supports updating the position of the encoder and retrieving the
-/// state of the pushbutton. Since Interrupts are not supported the update() 
-/// function has got to be called at least every 50ms for the readings to 
-/// be accurate enough for use.
+/// state of the pushbutton. The quadrature (Gray-code) signal is decoded with a
+/// 16-entry state table; invalid transitions (bounces where both pins change at
+/// once) are ignored and counted. A step is only counted when the encoder comes
+/// to rest in its detent, so one detent is exactly one step.
+///
+/// The update() function has got to be called at a fixed rate of at least 500Hz;
+/// preferably from a timer interrupt (see inputSampler and sampleTimer). The
+/// position is atomic, so it can be read from the main loop while update() is
+/// called from an interrupt. The rate is also used to determine the velocity, which
+/// is turned into a step size; spinning fast gives larger steps.
 /// 
 ///	All supported operations are:
 ///		- Get Position
 ///		- Set Position
+///		- Get Velocity and Step Size
 ///		- Get Button State
 ///		- Update Position and Button
 ///
@@ -23,15 +33,12 @@
 /// auto DT = hwlib::target::pin_in( hwlib::target::pins::d24 );
 /// auto SW = hwlib::target::pin_in( hwlib::target::pins::d26 );
 /// auto button = KY040(CLK, DT, SW);
+/// button.setUpdateFrequency(1000);
 /// 
 /// for(;;){
 /// 	button.update();
-/// 	hwlib::cout << button.getPos() << hwlib::endl;
-/// 	while(button.isPressed()){
-/// 		button.update();
-/// 		hwlib::wait_ms(5);
-/// 		hwlib::cout << "Pressed" << hwlib::endl;
-/// 	}
+/// 	hwlib::cout << button.getPos() << " at " << button.getVelocity() << " steps/s" << hwlib::endl;
+/// 	hwlib::wait_ms(1);
 /// }
 /// ~~~~~~~~~~~~~~~
 class KY040{
@@ -39,10 +46,17 @@ class KY040{
 	   	hwlib::pin_in & CLK;
 	    hwlib::pin_in & DT;
 	    hwlib::pin_in & SW;
-	    int posCounter;
-	    bool swPress;
-	    int lastPos;
-	    int curPos;
+	    std::atomic<int> posCounter;
+	    std::atomic<bool> swPress;
+	    uint8_t state;
+	    int quarterSteps = 0;
+	    unsigned int invalidTransitions = 0;
+
+	    unsigned int updateFrequency = 1000;
+	    unsigned int updates = 0;
+	    unsigned int lastStepUpdate = 0;
+	    int velocity = 0;
+	    void step(const int direction);
   	public:
 	    KY040(hwlib::pin_in & CLK, hwlib::pin_in & DT, hwlib::pin_in & SW = hwlib::pin_in_dummy, const int posCounter = 0, const bool swPress = false);
 	    void update();
@@ -50,6 +64,11 @@ class KY040{
 	    void setPos(const int newPos);
 	    bool isPressed();
 
+	    void setUpdateFrequency(const unsigned int frequency);
+	    int getVelocity();
+	    unsigned int getStepSize(const unsigned int maxStepSize = 10);
+	    unsigned int getInvalidTransitions();
+
 	    bool testCorrectFunctioning();
 };
 
@@ -24,19 +24,19 @@ int main( void ){
 			hwlib::cout << "Button pressed!" << hwlib::endl;
 			while(button.isPressed()){
 				button.update();
-				hwlib::wait_ms(5);
+				hwlib::wait_ms(1);
 			}
 			hwlib::cout << hwlib::endl;
 			break;
 		}
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 
 	hwlib::cout << "Keep the button pressed for 5 seconds." << hwlib::endl;
 	button.update();
 	while(!button.isPressed()){
 		button.update();
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 	if(button.isPressed()){
 		hwlib::cout << "Button pressed!" << hwlib::endl;
@@ -54,7 +54,7 @@ int main( void ){
 			hwlib::wait_ms(250);
 		}
 	}
-	hwlib::wait_ms(5);
+	hwlib::wait_ms(1);
 
 
 	hwlib::cout << "Turn Rotary Encoder Clockwise." << hwlib::endl;
@@ -66,7 +66,7 @@ int main( void ){
 			hwlib::cout << "Turned Clockwise!" << hwlib::endl << hwlib::endl;
 			break;
 		}
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 
 	hwlib::cout << "Turn Rotary Encoder 5x Clockwise." << hwlib::endl;
@@ -78,7 +78,7 @@ int main( void ){
 			hwlib::cout << "Turned 5x Clockwise!" << hwlib::endl << hwlib::endl;
 			break;
 		}
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 
 	hwlib::cout << "Turn Rotary Encoder Counter-Clockwise." << hwlib::endl;
@@ -90,7 +90,7 @@ int main( void ){
 			hwlib::cout << "Turned Counter-Clockwise!" << hwlib::endl << hwlib::endl;
 			break;
 		}
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 
 	hwlib::cout << "Turn Rotary Encoder 5x Counter-Clockwise." << hwlib::endl;
@@ -102,9 +102,21 @@ int main( void ){
 			hwlib::cout << "Turned 5x Counter-Clockwise!" << hwlib::endl << hwlib::endl;
 			break;
 		}
-		hwlib::wait_ms(5);
+		hwlib::wait_ms(1);
 	}
 
+	hwlib::cout << "Spin Rotary Encoder fast." << hwlib::endl;
+	button.setUpdateFrequency(1000);
+	for(;;){
+		button.update();
+		if(button.getStepSize() > 1){
+			hwlib::cout << "Spun at " << button.getVelocity() << " steps/s; step size " << button.getStepSize() << "!" << hwlib::endl << hwlib::endl;
+			break;
+		}
+		hwlib::wait_ms(1);
+	}
+	hwlib::cout << "Invalid transitions: " << button.getInvalidTransitions() << hwlib::endl;
+
 	hwlib::cout << hwlib::endl << "Test Succeeded" << hwlib::endl;
 }
 
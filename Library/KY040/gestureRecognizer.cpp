@@ -0,0 +1,151 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "gestureRecognizer.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the queue with inputEvents. The sample frequency (defaults to 1kHz)
+/// converts the double-click time (defaults to 300ms) and long-press time (defaults to 800ms) to samples.
+gestureRecognizer::gestureRecognizer(inputQueue & input, const unsigned int sampleFrequency, const unsigned int doubleClickTime, const unsigned int longPressTime):
+	input(input),
+	doubleClickSamples(sampleFrequency * doubleClickTime / 1000),
+	longPressSamples(sampleFrequency * longPressTime / 1000)
+{}
+
+/// \brief
+/// Poll Gesture
+/// \details
+/// This function handles the queued inputEvents until a gesture has been recognized, which is then moved to the given
+/// reference. When the queue is empty, the timeouts of a pending click and a held button are checked against 'now', the
+/// current sample. Returns false when there is no gesture (yet); call it again later.
+bool gestureRecognizer::poll(gestureEvent & gesture, const unsigned int now){
+	if(hasDeferred){
+		gesture = deferred;
+		hasDeferred = false;
+		return true;
+	}
+	inputEvent event;
+	while(input.pop(event)){
+		if(handle(event, gesture)){
+			return true;
+		}
+	}
+	return timeout(gesture, now);
+}
+
+/// \brief
+/// Handle Event
+/// \details
+/// This function updates the state with one inputEvent. It returns true when a gesture has been recognized. When one
+/// event completes two gestures (a turn or a press-and-turn right after a click), the second one is deferred to the
+/// next poll.
+bool gestureRecognizer::handle(const inputEvent & event, gestureEvent & gesture){
+	const bool clockwise = (event.type == inputType::turnClockwise);
+	switch(event.type){
+		case inputType::press:
+			pressed = true;
+			turned = false;
+			longPressed = false;
+			pressSample = event.sample;
+			if(clickPending){
+				if(event.sample - releaseSample <= doubleClickSamples){
+					secondPress = true;
+				} else {
+					clickPending = false;
+					gesture = gestureEvent{gestureType::click, 1};
+					return true;
+				}
+			}
+			return false;
+		case inputType::release:
+			if(!pressed){
+				return false;
+			}
+			pressed = false;
+			if(turned || longPressed){
+				secondPress = false;
+				return false;
+			}
+			if(secondPress){
+				secondPress = false;
+				clickPending = false;
+				gesture = gestureEvent{gestureType::doubleClick, 1};
+				return true;
+			}
+			if(event.sample - pressSample >= longPressSamples){
+				gesture = gestureEvent{gestureType::longPress, 1};
+				return true;
+			}
+			if(!doubleClick){
+				gesture = gestureEvent{gestureType::click, 1};
+				return true;
+			}
+			clickPending = true;
+			releaseSample = event.sample;
+			return false;
+		case inputType::turnClockwise:
+		case inputType::turnCounterClockwise:
+			if(pressed){
+				turned = true;
+				secondPress = false;
+				gesture = gestureEvent{clockwise ? gestureType::pressTurnClockwise : gestureType::pressTurnCounterClockwise, event.stepSize};
+				if(clickPending){
+					clickPending = false;
+					deferred = gesture;			//The click before this press goes first
+					hasDeferred = true;
+					gesture = gestureEvent{gestureType::click, 1};
+				}
+				return true;
+			}
+			if(clickPending){
+				clickPending = false;
+				gesture = gestureEvent{gestureType::click, 1};
+				deferred = gestureEvent{clockwise ? gestureType::turnClockwise : gestureType::turnCounterClockwise, event.stepSize};
+				hasDeferred = true;
+				return true;
+			}
+			gesture = gestureEvent{clockwise ? gestureType::turnClockwise : gestureType::turnCounterClockwise, event.stepSize};
+			return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Timeout
+/// \details
+/// This function reports a long-press when the button has been held long enough without turning, and a click when
+/// no second press has followed within the double-click time (or right away when double-clicks aren't used). When the
+/// long-press is the second press of a pending click, the click is reported first and the long-press is deferred to
+/// the next poll.
+bool gestureRecognizer::timeout(gestureEvent & gesture, const unsigned int now){
+	if(pressed && !turned && !longPressed && now - pressSample >= longPressSamples){
+		longPressed = true;
+		secondPress = false;
+		gesture = gestureEvent{gestureType::longPress, 1};
+		if(clickPending){
+			clickPending = false;
+			deferred = gesture;
+			hasDeferred = true;
+			gesture = gestureEvent{gestureType::click, 1};
+		}
+		return true;
+	}
+	if(clickPending && !pressed && (!doubleClick || now - releaseSample > doubleClickSamples)){
+		clickPending = false;
+		gesture = gestureEvent{gestureType::click, 1};
+		return true;
+	}
+	return false;
+}
+
+/// \brief
+/// Use Double-Click
+/// \details
+/// This function sets whether double-clicks are recognized (the default). When they aren't, a click is reported as
+/// soon as the button is released instead of after the double-click time; for when a second click has no other
+/// meaning than a first one. A click that is already pending is reported with the next poll.
+void gestureRecognizer::useDoubleClick(const bool enabled){
+	doubleClick = enabled;
+}
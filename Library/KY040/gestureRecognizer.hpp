@@ -0,0 +1,84 @@
+/// @file
+
+#ifndef __GESTURE_RECOGNIZER_HPP
+#define __GESTURE_RECOGNIZER_HPP
+
+#include "inputSampler.hpp"
+
+/// \brief
+/// Gesture Type
+/// \details
+/// These are the gestures a gestureRecognizer makes of the inputEvents of a KY040. Turning while the
+/// button is held down is a different gesture than turning only.
+enum class gestureType : uint8_t {
+	turnClockwise,
+	turnCounterClockwise,
+	click,
+	doubleClick,
+	longPress,
+	pressTurnClockwise,
+	pressTurnCounterClockwise
+};
+
+/// \brief
+/// Gesture Event
+/// \details
+/// This struct contains one recognized gesture. For turns, the step size of the encoder is included.
+struct gestureEvent{
+	gestureType type = gestureType::click;
+	uint8_t stepSize = 1;
+};
+
+/// \brief
+/// Gesture Recognizer
+/// \details
+/// This is a class that turns the raw inputEvents of an inputSampler into gestures; click, double-click,
+/// long-press and press-and-turn. It never waits; all decisions are based on the timestamps (in samples) of
+/// the events and the current sample. A click is only reported when no second press follows within the
+/// double-click time, and a long-press is reported as soon as the button has been held long enough, even
+/// when it hasn't been released yet. After a long-press or a press-and-turn, the release is ignored.
+/// When double-clicks aren't used, a click is reported as soon as the button is released.
+///
+///	All supported operations are:
+///		- Poll Gesture
+///		- Use Double-Click
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto gestures = gestureRecognizer(inputEvents, 1000);	//Sampled at 1kHz
+/// gestureEvent gesture;
+/// gestures.useDoubleClick(false);			//Clicks without waiting for a second press
+/// for(;;){
+/// 	while(gestures.poll(gesture, sampler.getSamples())){
+/// 		if(gesture.type == gestureType::longPress){
+/// 			hwlib::cout << "Long Press" << hwlib::endl;
+/// 		}
+/// 	}
+/// }
+/// ~~~~~~~~~~~~~~~
+class gestureRecognizer{
+	private:
+		inputQueue & input;
+		const unsigned int doubleClickSamples;
+		const unsigned int longPressSamples;
+
+		bool doubleClick = true;
+		bool pressed = false;
+		bool secondPress = false;
+		bool turned = false;
+		bool longPressed = false;
+		bool clickPending = false;
+		unsigned int pressSample = 0;
+		unsigned int releaseSample = 0;
+
+		bool hasDeferred = false;
+		gestureEvent deferred;
+
+		bool handle(const inputEvent & event, gestureEvent & gesture);
+		bool timeout(gestureEvent & gesture, const unsigned int now);
+	public:
+		gestureRecognizer(inputQueue & input, const unsigned int sampleFrequency = 1000, const unsigned int doubleClickTime = 300, const unsigned int longPressTime = 800);
+		bool poll(gestureEvent & gesture, const unsigned int now);
+		void useDoubleClick(const bool enabled);
+};
+
+#endif //__GESTURE_RECOGNIZER_HPP
@@ -0,0 +1,55 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "inputSampler.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has two mandatory parameters; the encoder to sample and the queue to push the events in. The
+/// button has to be stable for 'debounceSamples' samples (defaults to 20; 20ms at 1kHz) before an edge is pushed.
+inputSampler::inputSampler(KY040 & encoder, inputQueue & queue, const unsigned int debounceSamples):
+	encoder(encoder),
+	queue(queue),
+	debounceSamples(debounceSamples),
+	lastPos(encoder.getPos())
+{}
+
+/// \brief
+/// Sample
+/// \details
+/// This function updates the encoder and pushes one event per step it has turned and one for every button edge that
+/// has been stable long enough. It is short enough to be called from an interrupt.
+void inputSampler::sample(){
+	encoder.update();
+	const int pos = encoder.getPos();
+	const uint8_t stepSize = encoder.getStepSize();
+	while(lastPos < pos){
+		queue.push(inputEvent{inputType::turnClockwise, samples, stepSize});
+		lastPos++;
+	}
+	while(lastPos > pos){
+		queue.push(inputEvent{inputType::turnCounterClockwise, samples, stepSize});
+		lastPos--;
+	}
+	if(encoder.isPressed() != pressed){
+		stableSamples++;
+		if(stableSamples >= debounceSamples){
+			pressed = !pressed;
+			stableSamples = 0;
+			queue.push(inputEvent{pressed ? inputType::press : inputType::release, samples, 1});
+		}
+	} else {
+		stableSamples = 0;
+	}
+	samples = samples + 1;
+}
+
+/// \brief
+/// Get Samples
+/// \details
+/// This function returns the amount of samples taken; the timestamp of the next event. It can be called
+/// from outside the interrupt as the current time of a gestureRecognizer.
+unsigned int inputSampler::getSamples(){
+	return samples;
+}
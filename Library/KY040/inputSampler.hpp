@@ -0,0 +1,77 @@
+/// @file
+
+#ifndef __INPUT_SAMPLER_HPP
+#define __INPUT_SAMPLER_HPP
+
+#include "KY040.hpp"
+#include "eventQueue.hpp"
+#include "sampleTimer.hpp"
+
+/// \brief
+/// Input Type
+/// \details
+/// These are the kinds of input events a KY040 produces; one step in either direction and the
+/// (debounced) press and release of the button.
+enum class inputType : uint8_t {
+	turnClockwise,
+	turnCounterClockwise,
+	press,
+	release
+};
+
+/// \brief
+/// Input Event
+/// \details
+/// This struct contains one input event and the sample at which it occured. The sample counter of the
+/// inputSampler is used as timestamp since hwlib::now_us() can't be used in an interrupt. For steps, the
+/// step size of the encoder at that moment is included; it is larger than 1 when the encoder is spun fast.
+struct inputEvent{
+	inputType type = inputType::release;
+	unsigned int sample = 0;
+	uint8_t stepSize = 1;
+};
+
+/// \brief
+/// Input Queue
+/// \details
+/// This is the queue in which an inputSampler pushes its events; 32 events are enough for about two full
+/// rotations of the encoder while the consumer is busy.
+using inputQueue = eventQueue<inputEvent, 32>;
+
+/// \brief
+/// Input Sampler
+/// \details
+/// This is a sampleTask that updates a KY040 and pushes every step and every (debounced) button edge as an
+/// inputEvent in a queue. When driven by a sampleTimer, the encoder keeps being sampled while the consumer of
+/// the queue is busy tuning the radio; no steps are lost as long as the queue doesn't overflow.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto queue = inputQueue();
+/// auto sampler = inputSampler(button, queue);
+/// auto timer = sampleTimer(sampler, 1000);
+/// timer.start();
+///
+/// inputEvent event;
+/// for(;;){
+/// 	timer.poll();
+/// 	while(queue.pop(event)){
+/// 		hwlib::cout << int(event.type) << hwlib::endl;
+/// 	}
+/// }
+/// ~~~~~~~~~~~~~~~
+class inputSampler : public sampleTask {
+	private:
+		KY040 & encoder;
+		inputQueue & queue;
+		const unsigned int debounceSamples;
+		int lastPos;
+		bool pressed = false;
+		unsigned int stableSamples = 0;
+		volatile unsigned int samples = 0;
+	public:
+		inputSampler(KY040 & encoder, inputQueue & queue, const unsigned int debounceSamples = 20);
+		void sample() override;
+		unsigned int getSamples();
+};
+
+#endif //__INPUT_SAMPLER_HPP
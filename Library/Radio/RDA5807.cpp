@@ -38,6 +38,10 @@ void RDA5807::setData(){
 /// This function is used to send one element of the data array. The index can be selected by the mandatory
 /// parameter. The data first has to be manually set before being send to the chip (via the Index Addres 0x11).
 void RDA5807::setData(const unsigned int regNumber){
+	if(batching){
+		batched |= (1U << regNumber);
+		return;
+	}
 	auto transaction = bus.write(indexAddress);
 	transaction.write(regNumber);
 	transaction.write((data[regNumber] & 0xFF00) >> 8);
@@ -94,16 +98,47 @@ void RDA5807::getStatus(){
 /// \details
 /// This function is used to initialize the chip and alter the settings so the chip can be used. It has one
 /// optional parameter; wheter to start muted or not. It defaults to false, so when a setFrequency() or seekChannel()
-/// function is called, music begins to play.
-void RDA5807::begin(const bool muted){
-	hwlib::wait_ms(1000);
+/// function is called, music begins to play. The second optional parameter is the time (in milliseconds) the chip
+/// needs after power-up before it can be initialized; it defaults to 1000. Pass 0 when that time has already passed;
+/// for example because other parts of the system have been started in the meantime.
+///
+/// All settings are first gathered and then sent register by register without waiting in between; the control
+/// register (which powers up the chip) is sent last. This only costs one wait of 30ms instead of one per setting.
+void RDA5807::begin(const bool muted, const unsigned int powerUpDelay){
+	hwlib::wait_ms(powerUpDelay);
+	batching = true;
 	setMute(muted);
 	setVolume(15);
 	normalAudio(true);
 	setTune(true);
-	hwlib::wait_ms(50);
 	enableRadioData(true);
 	powerUpEnable(true);
+	batching = false;
+	sendBatch();
+}
+
+/// \brief
+/// Send Batch
+/// \details
+/// This function sends all registers that have been changed while batching. Register 2 (control) is sent last, so
+/// all other settings are in place when the chip powers up. There is only one wait of 30ms; after the last register.
+void RDA5807::sendBatch(){
+	for(unsigned int i = 3; i < 8; i++){
+		if(batched & (1U << i)){
+			auto transaction = bus.write(indexAddress);
+			transaction.write(i);
+			transaction.write((data[i] & 0xFF00) >> 8);
+			transaction.write(data[i] & 0x00FF);
+		}
+	}
+	if(batched & (1U << 2)){
+		auto transaction = bus.write(indexAddress);
+		transaction.write(2);
+		transaction.write((data[2] & 0xFF00) >> 8);
+		transaction.write(data[2] & 0x00FF);
+	}
+	batched = 0;
+	hwlib::wait_ms(30);
 }
 
 /// \brief
@@ -378,17 +413,11 @@ unsigned int RDA5807::getSpacing(){
 }
 
 /// \brief
-/// Set Frequency
+/// Encode Frequency
 /// \details
-/// This function is used to set the Frequency. It has two mandatory parameters; the desired frequency and wether or not
-/// to auto tune. setFrequency(const float frequency) has only one mandatory parameter; autoTune will default to true.
-/// When the autoTune bit is set (true is passed) the chip will tune to the closest best frequency. When it is not
-/// set, the chip will leave it as is; without guarantee of best quality. If the tune operation fails, this function returns
-/// true. Though testing has pointed out this chip is not very good at determining this.
-/// If the passed frequency is outside the legal range, according to the set Band Limit, the chip will tune
-/// to the lowest legal frequency.
-bool RDA5807::setFrequency(const float frequency, const bool autoTune){
-	radioData.reset();		//Clear Received RDS-Data since this is not useful anymore and will only slow the process down
+/// This function puts the given frequency and the autoTune bit in register 3 of the data array; nothing is sent. When the
+/// frequency is outside the legal range of the set Band Limit, the lowest legal frequency is used.
+void RDA5807::encodeFrequency(const float frequency, const bool autoTune){
 	if(autoTune){
 		data[3] |= (1UL << 4);
 	} else {
@@ -426,6 +455,21 @@ bool RDA5807::setFrequency(const float frequency, const bool autoTune){
 		tunableFrequency = frequency * 10 - 870;
 	}
 	data[3] |= (tunableFrequency << 6);
+}
+
+/// \brief
+/// Set Frequency
+/// \details
+/// This function is used to set the Frequency. It has two mandatory parameters; the desired frequency and wether or not
+/// to auto tune. setFrequency(const float frequency) has only one mandatory parameter; autoTune will default to true.
+/// When the autoTune bit is set (true is passed) the chip will tune to the closest best frequency. When it is not
+/// set, the chip will leave it as is; without guarantee of best quality. If the tune operation fails, this function returns
+/// true. Though testing has pointed out this chip is not very good at determining this.
+/// If the passed frequency is outside the legal range, according to the set Band Limit, the chip will tune
+/// to the lowest legal frequency.
+bool RDA5807::setFrequency(const float frequency, const bool autoTune){
+	radioData.reset();		//Clear Received RDS-Data since this is not useful anymore and will only slow the process down
+	encodeFrequency(frequency, autoTune);
 	setData(3);
 	hwlib::wait_ms(100);
 	//Find out if tune action was completed.
@@ -544,6 +588,45 @@ unsigned int RDA5807::getVolume(){
 	return (data[5] & 0x000F);
 }
 
+/// \brief
+/// Start Tune
+/// \details
+/// This function starts tuning to the given frequency (with autoTune) and returns right away; register 3 is sent without
+/// waiting for the chip. Whether tuning has completed can be polled with tuneCompleted(). In contrary to setFrequency(),
+/// the received Radio Data is kept; this is meant for measuring many channels in a row, like a band scan does.
+void RDA5807::startTune(const float frequency){
+	encodeFrequency(frequency, true);
+	auto transaction = bus.write(indexAddress);
+	transaction.write(3);
+	transaction.write((data[3] & 0xFF00) >> 8);
+	transaction.write(data[3] & 0x00FF);
+}
+
+/// \brief
+/// Tune Completed
+/// \details
+/// This function reads the first two status registers with one transfer, without waiting afterwards, and returns true if
+/// the tune operation started with startTune() has completed (STC). The signal strength read with it can be asked with
+/// getMeasuredStrength().
+bool RDA5807::tuneCompleted(){
+	bus.write(indexAddress).write(firstReadRegister);
+	auto transaction = bus.read(indexAddress);
+	for(unsigned int i = 0; i < 2; i++){
+		status[i] = transaction.read_byte() << 8;
+		status[i] |= transaction.read_byte();
+	}
+	return (status[0] >> 14) & 1;
+}
+
+/// \brief
+/// Get Measured Signal Strength
+/// \details
+/// This function returns the signal strength that has been read by the last tuneCompleted(), on the same scale as
+/// signalStrength(). Nothing is read from the chip.
+unsigned int RDA5807::getMeasuredStrength(){
+	return ((status[1] & 0xFC00) >> 9);
+}
+
 /// \brief
 /// Set Tune
 /// \details
@@ -51,13 +51,18 @@ class RDA5807 : public Radio {
 		uint16_t status[6] = {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000};
 		const uint8_t indexAddress;			//0x11 for RDA5807
 		const uint8_t firstReadRegister;	//0x10 for RDA5807
+		bool batching = false;				//Gather register changes instead of sending them right away
+		uint8_t batched = 0;				//Registers changed while batching; one bit per register
 		void setData() override;
 		void setData(const unsigned int regNumber);
 		void setRegister(const unsigned int regNumber, const uint16_t value);
+		void sendBatch();
 
 		void getStatus() override;
 		void getStatus(const unsigned int regNumber);
 
+		void encodeFrequency(const float frequency, const bool autoTune);
+
 		//Specific Powerfull Setting; let user handle this through standBy().
 		void powerUpEnable(const bool enable);
 	public:
@@ -68,7 +73,7 @@ class RDA5807 : public Radio {
 		void setClockFrequency(const unsigned int frequency = 32) override;
 		unsigned int getClockFrequency() override;
 
-		void begin(const bool muted = false);
+		void begin(const bool muted = false, const unsigned int powerUpDelay = 1000);
 		void reset();
 
 		void setBandLimit(const unsigned int limit = 0) override;
@@ -89,6 +94,10 @@ class RDA5807 : public Radio {
 		void setTune(const bool tune = true);
 		bool isTuned();
 
+		void startTune(const float frequency);
+		bool tuneCompleted();
+		unsigned int getMeasuredStrength();
+
 		void demodulateMethod(const bool newMethod = true);		//Can Improve Signal Strength
 		bool newDemodulate();
 
@@ -77,6 +77,7 @@ char* radioDataSystem::getStationName(const unsigned int dataValidity){
 		radioData.receivedStationName[i] = ' ';
 		radioData.realStationName[i] = ' ';
 	}
+	radioData.nameSegments = 0;
 	getStatus();
 	for(unsigned int i = 0; i < dataValidity * 15; i++){
 		getStatus();
@@ -116,7 +117,10 @@ char* radioDataSystem::getStationName(const unsigned int dataValidity){
 			hwlib::wait_ms(20);
 		}
 	}
-	return radioData.receivedStationName;
+	for(unsigned int i = 0; i < 8; i++){
+		radioData.confirmedStationName[i] = radioData.receivedStationName[i];
+	}
+	return radioData.confirmedStationName;
 }
 
 /// \brief
@@ -180,9 +184,9 @@ char* radioDataSystem::getStationText(){
 /// both the status array and the Blocks, information that is at the same index and at the same block for both version A and B,
 /// can just be asked through simple functions. But since Version A and B have different names, they support different data and 
 /// even if they contain the same info; not at the same index in the same block. For most data there has got to be made a difference
-/// between verion A and B. That's where this function comes in. Firstly, the data is refreshed. Secondly, the Station Name is 
-/// determined through getStationName(). Third, the Message Version is determined. And last, based on the Group Type,
-/// we can interpret the received Data, which is then stored and updated in radioData of type radioDataSystemData.
+/// between verion A and B. That's where this function comes in. Firstly, the data is refreshed. Secondly, the Message Version is
+/// determined. And last, based on the Group Type, we can interpret the received Data, which is then stored and updated in radioData
+/// of type radioDataSystemData. Every group 0 contains two characters of the Station Name; see addNameSegment().
 void radioDataSystem::update(){
 	getStatus();
 	radioData.clearScreenRequest |= (radioData.blockB >> 4) & 1;
@@ -192,6 +196,7 @@ void radioDataSystem::update(){
 			if((radioData.blockB >> 11) & 1){		//Message Version A
 				switch(((radioData.blockB & 0xF000) >> 12)){		//Group Type
 					case 0:		//Basic Tuning Information
+						addNameSegment();
 						radioData.offset = 3 - ((radioData.charSegment0 * 1) + (radioData.charSegment1 * 2));
 						if(radioData.offset == 0){
 							if((radioData.blockB >> 2) & 1){
@@ -212,6 +217,8 @@ void radioDataSystem::update(){
 								radioData.staticProgramType = false;
 							}
 						}
+						addAlternative((radioData.blockC & 0xFF00) >> 8);		//Block C contains two Alternative Frequencies
+						addAlternative(radioData.blockC & 0x00FF);
 						break;
 					case 1:
 						radioData.PIN.setData((radioData.blockD & 0xF800) >> 11, (radioData.blockD & 0x07C0) >> 6, radioData.blockD & 0x003F);
@@ -222,7 +229,15 @@ void radioDataSystem::update(){
 						} else {
 							radioData.emergencyWarning = false;
 						}
+						break;
 					case 2:
+						if(((radioData.blockB >> 4) & 1) != radioData.textFlag){		//Text A/B flag toggled; a new RadioText
+							radioData.textFlag = !radioData.textFlag;
+							for(auto & element : radioData.rdsText){
+								element = ' ';
+							}
+							radioData.textChanges++;
+						}
 						getStationText();
 						break;
 					case 4:
@@ -233,6 +248,7 @@ void radioDataSystem::update(){
 			} else {
 				switch(((radioData.blockB & 0xF000) >> 12)){		//Group Type
 					case 0:		//Basic Tuning Information
+						addNameSegment();
 						radioData.offset = 3 - ((radioData.charSegment0 * 1) + (radioData.charSegment1 * 2));
 						if(radioData.offset == 0){
 							if((radioData.blockB >> 2) & 1){
@@ -258,6 +274,13 @@ void radioDataSystem::update(){
 						radioData.PIN.setData((radioData.blockD & 0xF800) >> 11, (radioData.blockD & 0x07C0) >> 6, radioData.blockD & 0x003F);
 						break;
 					case 2:
+						if(((radioData.blockB >> 4) & 1) != radioData.textFlag){		//Text A/B flag toggled; a new RadioText
+							radioData.textFlag = !radioData.textFlag;
+							for(auto & element : radioData.rdsText){
+								element = ' ';
+							}
+							radioData.textChanges++;
+						}
 						getStationText();
 						break;
 					default:
@@ -320,12 +343,17 @@ unsigned int radioDataSystem::radioDataErrors(const unsigned int block){
 /// This function resets the Radio Data. This way the process of retrieving Station Names and Texts is optimised
 /// after a change of Frequency. Has got to be called after a frequency change for good performance.
 void radioDataSystem::reset(){
-	for(auto & element : radioData.receivedStationName){
-		element = ' ';
+	for(unsigned int i = 0; i < 8; i++){
+		radioData.receivedStationName[i] = ' ';
+		radioData.realStationName[i] = ' ';
+		radioData.confirmedStationName[i] = ' ';
 	}
+	radioData.nameSegments = 0;
 	for(auto & element : radioData.rdsText){
 		element = ' ';
 	}
+	radioData.amountOfAlternatives = 0;
+	radioData.textChanges++;
 	getStatus();
 }
 
@@ -398,6 +426,94 @@ unsigned int radioDataSystem::getProgramRefrence(){
 	return (radioData.blockA & 0x00FF);
 }
 
+/// \brief
+/// Get Program Identification
+/// \details
+/// This function returns the complete Program Identification; the Country Code, Program Area and Program Refrence Number
+/// in one number. It identifies the station, no matter on which frequency it is received.
+uint16_t radioDataSystem::getProgramIdentification(){
+	return radioData.blockA;
+}
+
+/// \brief
+/// Add Alternative Frequency
+/// \details
+/// This function adds the given code of a received Alternative Frequency to the sorted list. Codes that aren't a
+/// frequency (the amount of frequencies that follow, fillers and LF/MF frequencies) and codes that are in the list
+/// already are ignored, so the list doesn't change anymore once all Alternative Frequencies have been received.
+void radioDataSystem::addAlternative(const uint8_t code){
+	if(code < 1 || code > 204 || radioData.amountOfAlternatives >= radioDataSystemData::maxAlternatives){
+		return;
+	}
+	unsigned int position = 0;
+	while(position < radioData.amountOfAlternatives && radioData.alternatives[position] < code){
+		position++;
+	}
+	if(position < radioData.amountOfAlternatives && radioData.alternatives[position] == code){
+		return;
+	}
+	for(unsigned int i = radioData.amountOfAlternatives; i > position; i--){
+		radioData.alternatives[i] = radioData.alternatives[i - 1];
+	}
+	radioData.alternatives[position] = code;
+	radioData.amountOfAlternatives++;
+}
+
+/// \brief
+/// Add Station Name Segment
+/// \details
+/// This function stores the two characters of the Station Name in block D of a group 0A or 0B at the segment given by
+/// the last two bits of block B. Once all four segments have been received, the name is complete. It is only published
+/// (see stationName()) when it has been received completely the same twice in a row, so a bit error is never shown.
+void radioDataSystem::addNameSegment(){
+	radioData.charSegment0 = (radioData.blockB & 1);
+	radioData.charSegment1 = (radioData.blockB >> 1) & 1;
+	radioData.first = ((radioData.blockD & 0xFF00) >> 8);
+	radioData.second = (radioData.blockD & 0x00FF);
+	if(radioData.first < 32 || radioData.first > 126 || radioData.second < 32 || radioData.second > 126){
+		return;
+	}
+	const unsigned int segment = radioData.blockB & 3;
+	radioData.receivedStationName[segment * 2] = radioData.first;
+	radioData.receivedStationName[segment * 2 + 1] = radioData.second;
+	radioData.nameSegments |= 1 << segment;
+	if(radioData.nameSegments != 0x0F){
+		return;
+	}
+	radioData.nameSegments = 0;
+	bool same = true;
+	for(unsigned int i = 0; i < 8; i++){
+		same &= radioData.receivedStationName[i] == radioData.realStationName[i];
+		radioData.realStationName[i] = radioData.receivedStationName[i];
+	}
+	if(same){
+		for(unsigned int i = 0; i < 8; i++){
+			radioData.confirmedStationName[i] = radioData.realStationName[i];
+		}
+	}
+}
+
+/// \brief
+/// Get Amount of Alternative Frequencies
+/// \details
+/// This function returns the amount of Alternative Frequencies that have been received since the last reset(). They are
+/// sent in group 0A, two at a time, so it takes a while before the list is complete.
+unsigned int radioDataSystem::getAmountOfAlternatives(){
+	return radioData.amountOfAlternatives;
+}
+
+/// \brief
+/// Get Alternative Frequency
+/// \details
+/// This function returns the Alternative Frequency (in kHz) at the given index; they are sorted from low to high. It
+/// returns 0 when there is no Alternative Frequency at that index.
+unsigned int radioDataSystem::getAlternativeFrequency(const unsigned int index){
+	if(index >= radioData.amountOfAlternatives){
+		return 0;
+	}
+	return 87500 + radioData.alternatives[index] * 100;
+}
+
 /// \brief
 /// Get Message Group Type
 /// \details
@@ -432,9 +548,10 @@ bool radioDataSystem::currentMusic(){
 /// Get Station Name
 /// \details
 /// This function returns the Station Name but doesn't update it. Thus, the user will have to call update()
-/// at least once or call getStationName().
+/// regularly or call getStationName(). update() only changes it once the name has been received the same twice;
+/// until then it is blank.
 char* radioDataSystem::stationName(){
-	return &radioData.receivedStationName[0];
+	return &radioData.confirmedStationName[0];
 }
 
 /// \brief
@@ -446,6 +563,15 @@ char* radioDataSystem::stationText(){
 	return radioData.rdsText;
 }
 
+/// \brief
+/// Get Amount of Text Changes
+/// \details
+/// This function returns how many times a new RadioText has started; after a reset() (a new frequency) or when the
+/// Text A/B flag has toggled. When it has changed, the RadioText should be shown from its start again.
+unsigned int radioDataSystem::getTextChanges(){
+	return radioData.textChanges;
+}
+
 /// \brief
 /// Get Traffic Program
 /// \details
@@ -81,6 +81,7 @@ struct radioDataSystemData{
 	bool charSegment1;
 	bool charSegment2;
 	bool charSegment3;
+	uint8_t nameSegments = 0;			//Segments of the Station Name received since it was last complete
 
 	//Miscellaneous
 	unsigned int minutes = 0;
@@ -89,6 +90,8 @@ struct radioDataSystemData{
 	unsigned int slowLabeling;
 	bool emergencyWarning;
 	bool clearScreenRequest;
+	bool textFlag = false;				//Text A/B flag of group 2; toggles when a new RadioText starts
+	unsigned int textChanges = 0;
 
 	//Used for Decoding and validating validity of received info
 	unsigned int validI = 0;
@@ -98,9 +101,15 @@ struct radioDataSystemData{
 	//Used to store received Data
 	char receivedStationName[10] = {"         "};
 	char realStationName[10] = {"         "};
+	char confirmedStationName[9] = {"        "};
 	char rdsText[64] = {"                                                               "};
 	uint16_t status[6] = {};
 
+	//Alternative Frequencies; sorted codes from 1 (87.6MHz) up to 204 (107.9MHz)
+	static constexpr unsigned int maxAlternatives = 25;
+	uint8_t alternatives[maxAlternatives] = {};
+	unsigned int amountOfAlternatives = 0;
+
 	//Specific data format containing broadcast start time
 	programItemNumber PIN;
 
@@ -171,6 +180,8 @@ class radioDataSystem{
 		bool radioDataReady();
 		bool radioDataSynced();
 		radioDataSystemData radioData;
+		void addAlternative(const uint8_t code);
+		void addNameSegment();
 	public:
 		radioDataSystem(hwlib::i2c_bus_bit_banged_scl_sda & bus, const uint8_t address = 0x10, const uint8_t firstReadAddress = 0x0A);
 		void rawData();
@@ -179,11 +190,15 @@ class radioDataSystem{
 		char* stationName();
 		char* getStationText();
 		char* stationText();
+		unsigned int getTextChanges();
 		bool clearScreen();
 		bool trafficProgram();			//This channel features traffic announcements
 		bool trafficAnnouncement();		//This channel currently talks about traffic
 		unsigned int getProgramArea();
 		unsigned int getProgramRefrence();
+		uint16_t getProgramIdentification();
+		unsigned int getAmountOfAlternatives();
+		unsigned int getAlternativeFrequency(const unsigned int index);
 		char getMessageGroupType();
 		unsigned int getProgramType();
 		bool stereo();
@@ -0,0 +1,235 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "SSD1306.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the I2C bus. The address defaults to 0x3C and the width of
+/// one chunk to 32 columns; a quarter page. Smaller chunks give other bus users more opportunities to go first,
+/// larger chunks have less overhead. The display is initialized (charge pump on, horizontal addressing) and cleared.
+SSD1306::SSD1306(hwlib::i2c_bus_bit_banged_scl_sda & bus, const uint8_t address, const unsigned int chunkWidth):
+	window(hwlib::xy(width, pages * 8), hwlib::white, hwlib::black),
+	bus(bus),
+	address(address),
+	chunkWidth((chunkWidth > 0 && chunkWidth <= width) ? chunkWidth : width)
+{
+	command(0xAE);				//Display off
+	command(0xD5, 0x80);		//Clock divide ratio and oscillator frequency
+	command(0xA8, 0x3F);		//Multiplex ratio of 64
+	command(0xD3, 0x00);		//No display offset
+	command(0x40);				//Start line 0
+	command(0x8D, 0x14);		//Enable charge pump
+	command(0x20, 0x00);		//Horizontal addressing mode
+	command(0xA1);				//Segment remap
+	command(0xC8);				//Scan COM outputs in reverse
+	command(0xDA, 0x12);		//Alternative COM pin configuration
+	command(0x81, 0xCF);		//Contrast
+	command(0xD9, 0xF1);		//Pre-charge period
+	command(0xDB, 0x40);		//VCOMH deselect level
+	command(0xA4);				//Display follows RAM content
+	command(0xA6);				//Normal, not inverted
+	command(0xAF);				//Display on
+	clear(background);
+	invalidate();				//The RAM of the display contains noise after power-up
+	flush();
+}
+
+/// \brief
+/// Send Command
+/// \details
+/// These functions send a command, optionally followed by one or two parameters, to the display. Every byte is
+/// preceded by control byte 0x80 (single command byte) except the last one, which is preceded by 0x00.
+void SSD1306::command(const uint8_t value){
+	const uint8_t data[] = {0x00, value};
+	bus.write(address).write(data, 2);
+}
+
+void SSD1306::command(const uint8_t value, const uint8_t parameter){
+	const uint8_t data[] = {0x80, value, 0x00, parameter};
+	bus.write(address).write(data, 4);
+}
+
+void SSD1306::command(const uint8_t value, const uint8_t first, const uint8_t second){
+	const uint8_t data[] = {0x80, value, 0x80, first, 0x00, second};
+	bus.write(address).write(data, 6);
+}
+
+/// \brief
+/// Send Chunk
+/// \details
+/// This function sends the columns from startColumn up to (not including) endColumn of the given page to the
+/// display. The addressing window is set first so the data lands at the right position.
+void SSD1306::sendChunk(const unsigned int page, const unsigned int startColumn, const unsigned int endColumn){
+	command(0x21, startColumn, endColumn - 1);		//Column address range
+	command(0x22, page, page);						//Page address range
+	auto transaction = bus.write(address);
+	transaction.write(0x40);						//Data follows
+	transaction.write(&buffer[page * width + startColumn], endColumn - startColumn);
+	sentBytes += endColumn - startColumn;
+}
+
+/// \brief
+/// Mark Dirty
+/// \details
+/// This function extends the dirty range of the given page with the given column.
+void SSD1306::markDirty(const unsigned int page, const unsigned int column){
+	if(dirtyStart[page] >= dirtyEnd[page]){
+		dirtyStart[page] = column;
+		dirtyEnd[page] = column + 1;
+	} else if(column < dirtyStart[page]){
+		dirtyStart[page] = column;
+	} else if(column >= dirtyEnd[page]){
+		dirtyEnd[page] = column + 1;
+	}
+}
+
+/// \brief
+/// Write Pixel
+/// \details
+/// This function sets or clears the given pixel in the buffer. Only when the pixel actually changes, its column is
+/// marked dirty. Nothing is sent to the display until flush() is called.
+void SSD1306::write_implementation(hwlib::xy pos, hwlib::color col){
+	const unsigned int page = pos.y / 8;
+	const unsigned int index = pos.x + page * width;
+	uint8_t value = buffer[index];
+	if(col == foreground){
+		value |= (1 << (pos.y % 8));
+	} else {
+		value &= ~(1 << (pos.y % 8));
+	}
+	if(value != buffer[index]){
+		buffer[index] = value;
+		markDirty(page, pos.x);
+	}
+}
+
+/// \brief
+/// Attach To Bus Scheduler
+/// \details
+/// This function makes flush() request its transfer from the given scheduler instead of sending the buffer
+/// immediately. The display has got to be added to the scheduler as well; preferably with busPriority::display.
+void SSD1306::attach(busScheduler & newScheduler){
+	scheduler = &newScheduler;
+}
+
+/// \brief
+/// Clear
+/// \details
+/// This function fills the complete buffer with the given color. This is a lot faster than clearing pixel by pixel.
+/// Only the columns that weren't in that color already are marked dirty.
+void SSD1306::clear(hwlib::color col){
+	const uint8_t value = (col == foreground) ? 0xFF : 0x00;
+	for(unsigned int page = 0; page < pages; page++){
+		for(unsigned int column = 0; column < width; column++){
+			if(buffer[page * width + column] != value){
+				buffer[page * width + column] = value;
+				markDirty(page, column);
+			}
+		}
+	}
+}
+
+/// \brief
+/// Flush
+/// \details
+/// This function sends the dirty parts of the buffer. When attached to a busScheduler the transfer is only requested;
+/// the chunks are sent by the scheduler. Otherwise, they are sent right away. When nothing has changed, nothing is sent.
+void SSD1306::flush(){
+	if(!flushPending()){
+		return;
+	}
+	if(scheduler != nullptr){
+		scheduler->request(*this);
+	} else {
+		while(!busStep()){}
+	}
+}
+
+/// \brief
+/// Send One Chunk
+/// \details
+/// This function sends the next chunk (at most 'chunkWidth' columns) of the dirty range of the first dirty page. It
+/// returns true when no pages are dirty anymore, so a busScheduler knows the flush has been completed.
+bool SSD1306::busStep(){
+	for(unsigned int page = 0; page < pages; page++){
+		if(dirtyStart[page] < dirtyEnd[page]){
+			const unsigned int startColumn = dirtyStart[page];
+			unsigned int endColumn = startColumn + chunkWidth;
+			if(endColumn > dirtyEnd[page]){
+				endColumn = dirtyEnd[page];
+			}
+			dirtyStart[page] = endColumn;
+			if(dirtyStart[page] >= dirtyEnd[page]){
+				dirtyStart[page] = 0;
+				dirtyEnd[page] = 0;
+			}
+			sendChunk(page, startColumn, endColumn);
+			return !flushPending();
+		}
+	}
+	return true;
+}
+
+/// \brief
+/// Flush Pending
+/// \details
+/// This function returns true if part of the buffer has changed and still has to be sent to the display.
+bool SSD1306::flushPending(){
+	for(unsigned int page = 0; page < pages; page++){
+		if(dirtyStart[page] < dirtyEnd[page]){
+			return true;
+		}
+	}
+	return false;
+}
+
+/// \brief
+/// Invalidate
+/// \details
+/// This function marks the complete buffer dirty, so the next flush() sends the whole frame. This is only needed when
+/// the content of the display can differ from the buffer; after power-up for example.
+void SSD1306::invalidate(){
+	for(unsigned int page = 0; page < pages; page++){
+		dirtyStart[page] = 0;
+		dirtyEnd[page] = width;
+	}
+}
+
+/// \brief
+/// Get Sent Bytes
+/// \details
+/// This function returns the amount of pixel data bytes that have been sent to the display since construction; the
+/// addressing overhead of every chunk is not included.
+unsigned int SSD1306::getSentBytes(){
+	return sentBytes;
+}
+
+/// \brief
+/// Set Contrast
+/// \details
+/// This function sets the contrast (brightness) of the display; from 0 to 255. It defaults to 0xCF.
+void SSD1306::setContrast(const uint8_t contrast){
+	command(0x81, contrast);
+}
+
+/// \brief
+/// Display On/Off
+/// \details
+/// This function turns the display on (true) or puts it to sleep (false). The buffer content is retained.
+void SSD1306::displayOn(const bool on){
+	if(on){
+		command(0xAF);
+	} else {
+		command(0xAE);
+	}
+}
+
+/// \brief
+/// Get I2C Address
+/// \details
+/// This function returns the address with which the display has been initialized.
+uint8_t SSD1306::getAddress(){
+	return address;
+}
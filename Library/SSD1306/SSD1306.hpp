@@ -0,0 +1,87 @@
+/// @file
+
+#ifndef __SSD1306_HPP
+#define __SSD1306_HPP
+
+#include "busScheduler.hpp"
+
+/// \brief
+/// SSD1306 OLED Interface
+/// \details
+/// This is a buffered interface for 128x64 SSD1306 OLED displays connected over I2C. It is a
+/// hwlib::window, so all hwlib terminals, window parts and drawables can be used on it. All drawing
+/// happens in a buffer in RAM; flush() sends the buffer to the display.
+///
+/// In contrary to hwlib::glcd_oled, the buffer is not sent in one long transfer. Per page (8 rows) the range
+/// of columns that has actually changed since the last flush is tracked; drawing a pixel in the color it
+/// already has changes nothing. flush() only sends those dirty ranges, split in chunks of at most 'chunkWidth'
+/// columns. When the display is attached to a busScheduler, flush() only requests the transfer and every run()
+/// of the scheduler sends one chunk. This way reading the signal strength or Radio Data never has to wait on a
+/// complete frame, and a refresh in which only a few characters change costs a few dozen bytes instead of 1KB.
+///
+///	All supported operations are:
+///		- Draw (through hwlib::window)
+///		- Clear
+///		- Flush (immediately or chunked through a busScheduler)
+///		- Invalidate (send everything with the next flush)
+///		- Get Amount of Sent Bytes
+///		- Set Contrast
+///		- Display On/Off
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto scl = target::pin_oc( target::pins::d8 );
+/// auto sda = target::pin_oc( target::pins::d9 );
+/// auto i2c_bus = hwlib::i2c_bus_bit_banged_scl_sda(scl, sda);
+///
+/// auto oled = SSD1306(i2c_bus);
+/// auto font = hwlib::font_default_8x8();
+/// auto terminal = hwlib::terminal_from(oled, font);
+///
+/// auto bus = busScheduler();
+/// bus.add(oled, busPriority::display, "Display Flush");
+/// oled.attach(bus);
+///
+/// terminal << "\f" << "Hello World!" << hwlib::flush;	//Only requests the transfer
+/// bus.runAll();											//Sends the chunks
+/// ~~~~~~~~~~~~~~~
+class SSD1306 : public hwlib::window, public busTask {
+	private:
+		static constexpr unsigned int width = 128;
+		static constexpr unsigned int pages = 8;
+		hwlib::i2c_bus & bus;
+		const uint8_t address;
+		const unsigned int chunkWidth;
+		uint8_t buffer[width * pages] = {};
+		uint8_t dirtyStart[pages] = {};		//First dirty column per page
+		uint8_t dirtyEnd[pages] = {};			//One past the last dirty column per page; equal to start when clean
+		unsigned int sentBytes = 0;
+		busScheduler * scheduler = nullptr;
+
+		void markDirty(const unsigned int page, const unsigned int column);
+
+		void command(const uint8_t value);
+		void command(const uint8_t value, const uint8_t parameter);
+		void command(const uint8_t value, const uint8_t first, const uint8_t second);
+		void sendChunk(const unsigned int page, const unsigned int startColumn, const unsigned int endColumn);
+	protected:
+		void write_implementation(hwlib::xy pos, hwlib::color col) override;
+	public:
+		SSD1306(hwlib::i2c_bus_bit_banged_scl_sda & bus, const uint8_t address = 0x3C, const unsigned int chunkWidth = 32);
+
+		void attach(busScheduler & newScheduler);
+
+		void clear(hwlib::color col) override;
+		using hwlib::window::clear;
+		void flush() override;
+		bool busStep() override;
+		bool flushPending();
+		void invalidate();
+		unsigned int getSentBytes();
+
+		void setContrast(const uint8_t contrast = 0xCF);
+		void displayOn(const bool on = true);
+
+		uint8_t getAddress();
+};
+
+#endif //__SSD1306_HPP
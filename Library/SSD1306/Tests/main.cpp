@@ -0,0 +1,66 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "SSD1306.hpp"
+
+/// \brief
+/// Test
+/// \details
+/// This program tests ALL functionality of the SSD1306 OLED. Since wether or not something is displayed
+/// can only be seen, the user has to look at the display while the test is running.
+int main( void ){
+  namespace target = hwlib::target;
+
+  auto scl = target::pin_oc( target::pins::d8 );
+  auto sda = target::pin_oc( target::pins::d9 );
+  auto i2c_bus = hwlib::i2c_bus_bit_banged_scl_sda(scl, sda);
+
+  hwlib::wait_ms(1000);   //Wait for terminal
+
+  auto oled = SSD1306(i2c_bus);
+  auto font = hwlib::font_default_8x8();
+  auto terminal = hwlib::terminal_from(oled, font);
+
+  hwlib::cout << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "Initialization with default address: " << (oled.getAddress() == 0x3C) << hwlib::endl;
+
+  terminal << "\f" << "Direct flush" << hwlib::flush;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Flush without scheduler is sent immediately: " << !oled.flushPending() << hwlib::endl;
+  hwlib::wait_ms(2000);
+
+  auto bus = busScheduler();
+  bus.add(oled, busPriority::display, "Display Flush");
+  oled.attach(bus);
+
+  terminal << "\f" << "Chunked flush" << hwlib::flush;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Flush with scheduler is only requested: " << (oled.flushPending() && bus.isPending(oled)) << hwlib::endl;
+  auto bytes = oled.getSentBytes();
+  unsigned int chunks = 0;
+  while(bus.run()){
+    chunks++;
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Only the changed columns of the first page are sent: " << (chunks <= 4 && oled.getSentBytes() - bytes <= 128 && !oled.flushPending()) << hwlib::endl;
+
+  terminal << "\f" << "Chunked flush" << hwlib::flush;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Nothing is sent when nothing has changed: " << (!oled.flushPending() && !bus.isPending(oled)) << hwlib::endl;
+
+  oled.invalidate();
+  oled.flush();
+  bytes = oled.getSentBytes();
+  chunks = 0;
+  while(bus.run()){
+    chunks++;
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Invalidated frame is sent completely in 32 chunks: " << (chunks == 32 && oled.getSentBytes() - bytes == 1024) << hwlib::endl;
+  bus.printStatistics(hwlib::cout);
+  hwlib::wait_ms(2000);
+
+  hwlib::cout << "Display should dim, turn off and on again." << hwlib::endl;
+  oled.setContrast(0x10);
+  hwlib::wait_ms(1000);
+  oled.displayOn(false);
+  hwlib::wait_ms(1000);
+  oled.displayOn(true);
+  oled.setContrast();
+
+  hwlib::cout << hwlib::endl << "Test Succeeded" << hwlib::endl;
+}
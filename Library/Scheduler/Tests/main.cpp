@@ -0,0 +1,90 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "taskScheduler.hpp"
+#include "eventQueue.hpp"
+#include "bootSequence.hpp"
+
+/// \brief
+/// Test
+/// \details
+/// This program tests ALL functionality of the Task Scheduler, the Event Queue and the Boot Sequence. No chips are needed; the
+/// tasks only count how often they have been run and one of them takes too long on purpose.
+int main( void ){
+  hwlib::wait_ms(1000);   //Wait for terminal
+
+  unsigned int fastRuns = 0;
+  unsigned int slowRuns = 0;
+  bool slowTakesLong = false;
+  char first = ' ';
+
+  auto fast = taskFunction([&](){ if(first == ' '){ first = 'F'; } fastRuns++; });
+  auto slow = taskFunction([&](){ if(first == ' '){ first = 'S'; } slowRuns++; if(slowTakesLong){ hwlib::wait_ms(30); } });
+
+  auto scheduler = taskScheduler();
+  hwlib::cout << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "Tasks can be added: " << (scheduler.add(slow, 100, 100, "Slow") && scheduler.add(fast, 10, 2, "Fast")) << hwlib::endl;
+
+  scheduler.run();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Earliest deadline is run first: " << (first == 'F') << hwlib::endl;
+
+  auto start = scheduler.getTicks();
+  while(scheduler.getTicks() < start + 1000){
+    scheduler.run();
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Tasks are run once every period: " << (fastRuns >= 100 && fastRuns <= 102 && slowRuns >= 10 && slowRuns <= 11) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "No overruns when all tasks are short: " << (scheduler.getTotalOverruns() == 0) << hwlib::endl;
+
+  slowTakesLong = true;
+  scheduler.trigger(slow);
+  start = scheduler.getTicks();
+  while(scheduler.getTicks() < start + 50){
+    scheduler.run();
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Task that takes too long delays others into an overrun: " << (scheduler.getOverruns(fast) == 1 && scheduler.getOverruns(slow) == 0) << hwlib::endl;
+
+  slowTakesLong = false;
+  scheduler.enable(fast, false);
+  auto runs = fastRuns;
+  start = scheduler.getTicks();
+  while(scheduler.getTicks() < start + 50){
+    scheduler.run();
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Disabled task is not run: " << (fastRuns == runs) << hwlib::endl;
+
+  hwlib::cout << hwlib::endl;
+  scheduler.printStatistics(hwlib::cout);
+  hwlib::cout << hwlib::endl;
+
+  auto queue = eventQueue<int, 4>();
+  int value = 0;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Nothing can be popped from an empty queue: " << (queue.isEmpty() && !queue.pop(value)) << hwlib::endl;
+  queue.push(1);
+  queue.push(2);
+  queue.push(3);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Events are popped in order: " << (queue.pop(value) && value == 1 && queue.pop(value) && value == 2 && queue.size() == 1) << hwlib::endl;
+  queue.push(4);
+  queue.push(5);
+  queue.push(6);
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Events are dropped when the queue is full: " << (!queue.push(7) && queue.getDropped() == 1 && queue.size() == 4) << hwlib::endl;
+  bool inOrder = true;
+  for(int expected = 3; expected <= 6; expected++){
+    inOrder &= queue.pop(value) && value == expected;
+  }
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Queue wraps around without losing events: " << (inOrder && queue.isEmpty()) << hwlib::endl;
+
+  hwlib::cout << hwlib::endl;
+  auto boot = bootSequence();
+  unsigned int waitingParts = 0;
+  unsigned int slowParts = 0;
+  bool slowStartedFirst = false;
+  auto early = bootFunction([&](){ return true; });
+  auto waiting = bootFunction([&](){ return ++waitingParts == 3; });
+  auto later = bootFunction([&](){ if(waitingParts == 0){ slowStartedFirst = true; } return ++slowParts == 5; });
+  auto unknown = bootFunction([&](){ return true; });
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Stages can be added: " << (boot.add(early, "Early") && boot.add(waiting, "Waiting", &early, 100) && boot.add(later, "Later", &early)) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Stage can't depend on an unknown stage: " << !boot.add(early, "Unknown", &unknown) << hwlib::endl;
+  boot.runAll();
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Other stages go while a stage waits: " << slowStartedFirst << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "All stages are completed: " << (boot.isDone(early) && boot.isDone(waiting) && boot.isDone(later) && boot.getDuration() >= 100) << hwlib::endl;
+  boot.printTimeline(hwlib::cout);
+}
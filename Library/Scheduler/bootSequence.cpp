@@ -0,0 +1,142 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "bootSequence.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// The moment of construction is the start of the timeline; all times are relative to it.
+bootSequence::bootSequence():
+	start(hwlib::now_us())
+{}
+
+/// \brief
+/// Find Stage
+/// \details
+/// This function returns the index of the given stage, or -1 when it hasn't been added.
+int bootSequence::find(const bootStage & stage){
+	for(unsigned int i = 0; i < amountOfStages; i++){
+		if(slots[i].stage == &stage){
+			return i;
+		}
+	}
+	return -1;
+}
+
+/// \brief
+/// Add Stage
+/// \details
+/// This function adds a stage with a name for the timeline. The stage doesn't start before the stage it comes 'after'
+/// has been completed, nor before 'notBefore' milliseconds have passed since the construction of the sequence. The
+/// stage it comes after has to be added first. Returns false when there is no room left or that stage is unknown.
+bool bootSequence::add(bootStage & stage, const char * name, bootStage * after, const unsigned int notBefore){
+	if(amountOfStages >= maxStages){
+		return false;
+	}
+	const int afterIndex = (after != nullptr) ? find(*after) : -1;
+	if(after != nullptr && afterIndex < 0){
+		return false;
+	}
+	slots[amountOfStages].stage = &stage;
+	slots[amountOfStages].name = name;
+	slots[amountOfStages].after = afterIndex;
+	slots[amountOfStages].notBefore = notBefore * 1000ULL;
+	amountOfStages++;
+	return true;
+}
+
+/// \brief
+/// Is Ready
+/// \details
+/// This function returns true if the given stage has work left and is allowed to go.
+bool bootSequence::isReady(const stageSlot & slot, const uint_fast64_t now){
+	return !slot.done && now >= slot.notBefore && (slot.after < 0 || slots[slot.after].done);
+}
+
+/// \brief
+/// Run
+/// \details
+/// This function performs one part of the first stage that is able to go. When no stage can go yet, nothing is done.
+/// Returns true when all stages have been completed.
+bool bootSequence::run(){
+	bool completed = true;
+	for(unsigned int i = 0; i < amountOfStages; i++){
+		auto & slot = slots[i];
+		completed &= slot.done;
+		if(isReady(slot, hwlib::now_us() - start)){
+			if(!slot.started){
+				slot.started = true;
+				slot.start = hwlib::now_us() - start;
+			}
+			slot.steps++;
+			slot.done = slot.stage->bootStep();
+			if(slot.done){
+				slot.end = hwlib::now_us() - start;
+			}
+			return false;
+		}
+	}
+	return completed;
+}
+
+/// \brief
+/// Run All
+/// \details
+/// This function keeps running parts until all stages have been completed.
+void bootSequence::runAll(){
+	while(!run()){}
+}
+
+/// \brief
+/// Is Stage Done
+/// \details
+/// This function returns true if the given stage has been completed.
+bool bootSequence::isDone(const bootStage & stage){
+	const int index = find(stage);
+	return index >= 0 && slots[index].done;
+}
+
+/// \brief
+/// Get Duration
+/// \details
+/// This function returns the time (in milliseconds) from the construction of the sequence until the last stage was
+/// completed, or until now when stages are left.
+unsigned int bootSequence::getDuration(){
+	uint_fast64_t last = 0;
+	for(unsigned int i = 0; i < amountOfStages; i++){
+		if(!slots[i].done){
+			return (hwlib::now_us() - start) / 1000;
+		}
+		if(slots[i].end > last){
+			last = slots[i].end;
+		}
+	}
+	return last / 1000;
+}
+
+/// \brief
+/// Print Timeline
+/// \details
+/// This function prints, per stage, when it started and completed (in milliseconds since the construction of the
+/// sequence), in how many parts and a bar of 40 characters spanning the complete boot.
+void bootSequence::printTimeline(hwlib::ostream & stream){
+	const unsigned int duration = getDuration();
+	const unsigned int scale = (duration > 40) ? duration : 40;
+	stream << hwlib::left << hwlib::setw(16) << "Stage" << hwlib::setw(10) << "Start" << hwlib::setw(10) << "End"
+		<< hwlib::setw(8) << "Parts" << "|" << hwlib::endl;
+	for(unsigned int i = 0; i < amountOfStages; i++){
+		const auto & slot = slots[i];
+		const unsigned int first = slot.start / 1000;
+		const unsigned int last = slot.done ? slot.end / 1000 : duration;
+		stream << hwlib::left << hwlib::setw(16) << slot.name << hwlib::setw(10) << first << hwlib::setw(10) << last
+			<< hwlib::setw(8) << slot.steps << "|";
+		for(unsigned int column = 0; column < 40; column++){
+			const unsigned int from = column * scale / 40;
+			const unsigned int to = (column + 1) * scale / 40;
+			stream << ((slot.started && to > first && from <= last) ? '#' : ' ');
+		}
+		stream << "|" << hwlib::endl;
+	}
+	stream << "Boot completed after " << duration << "ms" << hwlib::endl;
+}
@@ -0,0 +1,103 @@
+/// @file
+
+#ifndef __BOOT_SEQUENCE_HPP
+#define __BOOT_SEQUENCE_HPP
+
+/// \brief
+/// Boot Stage
+/// \details
+/// This is an abstract class for all work that has to be done once while starting up. Every call to bootStep()
+/// performs one bounded part of the work and returns true when the stage has been completed, or false when there
+/// are parts left. Between the parts, other stages can go first.
+class bootStage{
+	public:
+		virtual bool bootStep() = 0;
+};
+
+/// \brief
+/// Boot Function
+/// \details
+/// This is a class which makes it possible to turn a lambda into a bootStage. The lambda should return true when
+/// the stage has been completed.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto presetLoad = bootFunction([&](){ presets.load(); return true; });
+/// ~~~~~~~~~~~~~~~
+template<typename T>
+class bootFunction : public bootStage {
+	private:
+		T function;
+	public:
+		bootFunction(T function):
+			function(function)
+		{}
+
+		bool bootStep() override {
+			return function();
+		}
+};
+
+/// \brief
+/// Boot Sequence
+/// \details
+/// This is a class that runs the stages of starting up interleaved instead of one after another. A stage can
+/// depend on another stage (it doesn't start before that one has been completed) and can have a moment before
+/// which it can't start; a chip that needs time to power up for example. Every call to run() performs one part of
+/// the first stage that is able to go; while one stage waits for its chip, the others continue. Stages are served
+/// in the order they have been added.
+///
+/// For every stage the moment it started and completed, relative to the construction of the sequence, is kept.
+/// printTimeline() prints them with a bar per stage, so it is visible which stages overlap and what the first frame
+/// waits on.
+///
+///	All supported operations are:
+///		- Add Stage
+///		- Run One Part or Run All
+///		- Is Stage Done
+///		- Get Duration
+///		- Print Timeline
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto boot = bootSequence();
+/// auto settingsLoad = bootFunction([&](){ settings.mount(); return true; });
+/// auto radioStart = bootFunction([&](){ radio.begin(false, 0); return true; });
+/// auto firstFrame = bootFunction([&](){ display.displayMenuUpdate(...); return true; });
+/// boot.add(settingsLoad, "Settings");
+/// boot.add(radioStart, "Radio", &settingsLoad, 1000);	//The radio needs 1 second to power up
+/// boot.add(firstFrame, "First Frame", &settingsLoad);		//Doesn't wait on the radio
+/// boot.runAll();
+/// boot.printTimeline(hwlib::cout);
+/// ~~~~~~~~~~~~~~~
+class bootSequence{
+	private:
+		struct stageSlot{
+			bootStage * stage = nullptr;
+			const char * name = "";
+			int after = -1;
+			uint_fast64_t notBefore = 0;
+			bool started = false;
+			bool done = false;
+			unsigned int steps = 0;
+			uint_fast64_t start = 0;
+			uint_fast64_t end = 0;
+		};
+		static constexpr unsigned int maxStages = 8;
+		std::array<stageSlot, maxStages> slots = {};
+		unsigned int amountOfStages = 0;
+		const uint_fast64_t start;
+		int find(const bootStage & stage);
+		bool isReady(const stageSlot & slot, const uint_fast64_t now);
+	public:
+		bootSequence();
+
+		bool add(bootStage & stage, const char * name, bootStage * after = nullptr, const unsigned int notBefore = 0);
+
+		bool run();
+		void runAll();
+		bool isDone(const bootStage & stage);
+
+		unsigned int getDuration();
+		void printTimeline(hwlib::ostream & stream);
+};
+
+#endif //__BOOT_SEQUENCE_HPP
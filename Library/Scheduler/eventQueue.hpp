@@ -0,0 +1,96 @@
+/// @file
+
+#ifndef __EVENT_QUEUE_HPP
+#define __EVENT_QUEUE_HPP
+
+#include <atomic>
+
+/// \brief
+/// Event Queue
+/// \details
+/// This is a lock-free queue for exactly one producer and one consumer; for example an interrupt that
+/// pushes input events and the main loop that pops them. The producer only writes the head and the consumer
+/// only writes the tail, so no interrupts have to be disabled. The capacity has got to be a power of two.
+/// When the queue is full, new events are dropped and counted.
+///
+///	All supported operations are:
+///		- Push (producer)
+///		- Pop (consumer)
+///		- Get Size
+///		- Get Amount of Dropped Events
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto queue = eventQueue<int, 16>();
+/// queue.push(5);		//In the interrupt
+///
+/// int value;
+/// while(queue.pop(value)){	//In the main loop
+/// 	hwlib::cout << value << hwlib::endl;
+/// }
+/// ~~~~~~~~~~~~~~~
+template<typename T, unsigned int capacity>
+class eventQueue{
+	private:
+		static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "The capacity of an eventQueue has got to be a power of two.");
+		T events[capacity] = {};
+		std::atomic<unsigned int> head{0};
+		std::atomic<unsigned int> tail{0};
+		std::atomic<unsigned int> dropped{0};
+	public:
+		/// \brief
+		/// Push
+		/// \details
+		/// This function adds an event to the queue. It may only be called by the producer. Returns false
+		/// if the queue was full; the event is dropped then.
+		bool push(const T & event){
+			const unsigned int currentHead = head.load(std::memory_order_relaxed);
+			if(currentHead - tail.load(std::memory_order_acquire) >= capacity){
+				dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return false;
+			}
+			events[currentHead % capacity] = event;
+			head.store(currentHead + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// \brief
+		/// Pop
+		/// \details
+		/// This function moves the oldest event to the given reference. It may only be called by the consumer.
+		/// Returns false if the queue was empty.
+		bool pop(T & event){
+			const unsigned int currentTail = tail.load(std::memory_order_relaxed);
+			if(currentTail == head.load(std::memory_order_acquire)){
+				return false;
+			}
+			event = events[currentTail % capacity];
+			tail.store(currentTail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// \brief
+		/// Is Empty
+		/// \details
+		/// This function returns true if there are no events in the queue.
+		bool isEmpty(){
+			return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+		}
+
+		/// \brief
+		/// Get Size
+		/// \details
+		/// This function returns the amount of events in the queue.
+		unsigned int size(){
+			return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+		}
+
+		/// \brief
+		/// Get Dropped
+		/// \details
+		/// This function returns the amount of events that have been dropped because the queue was full.
+		unsigned int getDropped(){
+			return dropped.load(std::memory_order_relaxed);
+		}
+};
+
+#endif //__EVENT_QUEUE_HPP
@@ -0,0 +1,129 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "sampleTimer.hpp"
+
+#if defined(BMPTK_TARGET_arduino_due) || defined(HWLIB_TARGET_arduino_due)
+	#define SAMPLE_TIMER_INTERRUPT
+#endif
+
+namespace {
+	sampleTimer * activeTimer = nullptr;
+}
+
+#ifdef SAMPLE_TIMER_INTERRUPT
+/// \brief
+/// Timer Counter 0 Interrupt
+/// \details
+/// This is the interrupt handler of Timer Counter 0, channel 0. Reading the status register acknowledges the interrupt.
+extern "C" void TC0_Handler(){
+	TC0->TC_CHANNEL[0].TC_SR;
+	if(activeTimer != nullptr){
+		activeTimer->sample();
+	}
+}
+#endif
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one mandatory parameter; the task to perform. The frequency (in Hz) defaults to 1kHz.
+/// The timer isn't started until start() is called.
+sampleTimer::sampleTimer(sampleTask & task, const unsigned int frequency):
+	task(task),
+	frequency((frequency > 0) ? frequency : 1000)
+{}
+
+/// \brief
+/// Start
+/// \details
+/// This function starts sampling. On the Arduino Due, Timer Counter 0 is clocked by MCK / 2 (42MHz) and interrupts
+/// every time it reaches RC. A sampleTimer that was started before is stopped.
+void sampleTimer::start(){
+	if(activeTimer != nullptr && activeTimer != this){
+		activeTimer->stop();
+	}
+	activeTimer = this;
+	running = true;
+	nextSample = hwlib::now_us();
+#ifdef SAMPLE_TIMER_INTERRUPT
+	PMC->PMC_PCER0 = (1 << ID_TC0);
+	TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKDIS;
+	TC0->TC_CHANNEL[0].TC_IDR = 0xFFFFFFFF;
+	TC0->TC_CHANNEL[0].TC_CMR = TC_CMR_TCCLKS_TIMER_CLOCK1 | TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC;
+	TC0->TC_CHANNEL[0].TC_RC = 42'000'000 / frequency;
+	TC0->TC_CHANNEL[0].TC_IER = TC_IER_CPCS;
+	NVIC_EnableIRQ(TC0_IRQn);
+	TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+#endif
+}
+
+/// \brief
+/// Stop
+/// \details
+/// This function stops sampling.
+void sampleTimer::stop(){
+#ifdef SAMPLE_TIMER_INTERRUPT
+	NVIC_DisableIRQ(TC0_IRQn);
+	TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKDIS;
+#endif
+	running = false;
+	if(activeTimer == this){
+		activeTimer = nullptr;
+	}
+}
+
+/// \brief
+/// Poll
+/// \details
+/// This function samples once for every period that has passed since the last sample. It does nothing when sampling
+/// is interrupt driven, so it can be called unconditionally.
+void sampleTimer::poll(){
+#ifndef SAMPLE_TIMER_INTERRUPT
+	if(running){
+		const uint_fast64_t now = hwlib::now_us();
+		while(nextSample <= now){
+			sample();
+			nextSample += 1'000'000 / frequency;
+		}
+	}
+#endif
+}
+
+/// \brief
+/// Sample
+/// \details
+/// This function performs the task once and counts the sample. It is called by the interrupt handler or poll().
+void sampleTimer::sample(){
+	task.sample();
+	samples = samples + 1;
+}
+
+/// \brief
+/// Is Interrupt Driven
+/// \details
+/// This function returns true if the samples are taken by a timer interrupt, or false when poll() has got to be called.
+bool sampleTimer::isInterruptDriven(){
+#ifdef SAMPLE_TIMER_INTERRUPT
+	return true;
+#else
+	return false;
+#endif
+}
+
+/// \brief
+/// Get Frequency
+/// \details
+/// This function returns the amount of samples per second.
+unsigned int sampleTimer::getFrequency(){
+	return frequency;
+}
+
+/// \brief
+/// Get Samples
+/// \details
+/// This function returns the amount of samples that have been taken since the start. It can be used as a clock with
+/// a resolution of one period.
+unsigned int sampleTimer::getSamples(){
+	return samples;
+}
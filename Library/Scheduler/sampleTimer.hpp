@@ -0,0 +1,59 @@
+/// @file
+
+#ifndef __SAMPLE_TIMER_HPP
+#define __SAMPLE_TIMER_HPP
+
+/// \brief
+/// Sample Task
+/// \details
+/// This is an abstract class for work that has to be done at a fixed, high rate; sampling inputs for example.
+/// The sample() function may be called from an interrupt, so it has to be short and may only share data with
+/// the rest of the program through something like an eventQueue. It may not use the I2C bus or hwlib::now_us().
+class sampleTask{
+	public:
+		virtual void sample() = 0;
+};
+
+/// \brief
+/// Sample Timer
+/// \details
+/// This is a class that calls the sample() function of a sampleTask at a fixed frequency. On the Arduino Due,
+/// Timer Counter 0 (channel 0) generates an interrupt every period, so sampling continues while the main loop is
+/// blocked by a tune or a display flush. On other targets (the host simulation for example), there are no
+/// interrupts; poll() has got to be called as often as possible and samples once for every period that has passed.
+/// Only one sampleTimer can be started at a time.
+///
+///	All supported operations are:
+///		- Start/Stop
+///		- Poll
+///		- Get Amount of Samples
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto sampler = inputSampler(button, queue);
+/// auto timer = sampleTimer(sampler, 1000);		//1kHz
+/// timer.start();
+/// for(;;){
+/// 	timer.poll();		//Does nothing when interrupt driven
+/// }
+/// ~~~~~~~~~~~~~~~
+class sampleTimer{
+	private:
+		sampleTask & task;
+		const unsigned int frequency;
+		volatile unsigned int samples = 0;
+		uint_fast64_t nextSample = 0;
+		bool running = false;
+	public:
+		sampleTimer(sampleTask & task, const unsigned int frequency = 1000);
+
+		void start();
+		void stop();
+		void poll();
+		void sample();
+
+		bool isInterruptDriven();
+		unsigned int getFrequency();
+		unsigned int getSamples();
+};
+
+#endif //__SAMPLE_TIMER_HPP
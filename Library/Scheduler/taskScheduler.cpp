@@ -0,0 +1,197 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "taskScheduler.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has one optional parameter; the duration of one tick in microseconds. It defaults to 1000, so
+/// periods and deadlines are given in milliseconds. Tick zero is the moment of construction.
+taskScheduler::taskScheduler(const unsigned int tickDuration):
+	tickDuration((tickDuration > 0) ? tickDuration : 1000),
+	start(hwlib::now_us())
+{}
+
+/// \brief
+/// Find Task
+/// \details
+/// This function returns the index of the slot the given task has been registered in, or -1 when
+/// the task has not been added.
+int taskScheduler::find(const periodicTask & task){
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		if(slots[i].task == &task){
+			return i;
+		}
+	}
+	return -1;
+}
+
+/// \brief
+/// Add Task
+/// \details
+/// This function registers a task with its period and deadline (both in ticks) and a name that is used when printing
+/// the statistics. A deadline of 0, or one longer than the period, is replaced by the period. The task is released
+/// right away. It returns false when the task could not be added because all slots are in use. Adding a task twice
+/// only changes its period, deadline and name.
+bool taskScheduler::add(periodicTask & task, const unsigned int period, const unsigned int deadline, const char * name){
+	auto index = find(task);
+	if(index < 0){
+		if(amountOfTasks >= maxTasks){
+			return false;
+		}
+		index = amountOfTasks++;
+		slots[index] = taskSlot();
+		slots[index].task = &task;
+		slots[index].release = hwlib::now_us();
+	}
+	slots[index].period = uint_fast64_t((period > 0) ? period : 1) * tickDuration;
+	slots[index].deadline = (deadline > 0 && deadline * tickDuration < slots[index].period) ? uint_fast64_t(deadline) * tickDuration : slots[index].period;
+	slots[index].name = name;
+	return true;
+}
+
+/// \brief
+/// Enable Task
+/// \details
+/// This function enables (true) or disables (false) the given task. A disabled task is not run; when it gets enabled
+/// again it is released right away.
+void taskScheduler::enable(periodicTask & task, const bool enable){
+	auto index = find(task);
+	if(index >= 0){
+		if(enable && !slots[index].enabled){
+			slots[index].release = hwlib::now_us();
+		}
+		slots[index].enabled = enable;
+	}
+}
+
+/// \brief
+/// Trigger Task
+/// \details
+/// This function releases the given task right away instead of waiting for the rest of its period. The next
+/// release is one period after this one.
+void taskScheduler::trigger(periodicTask & task){
+	auto index = find(task);
+	if(index >= 0){
+		slots[index].release = hwlib::now_us();
+	}
+}
+
+/// \brief
+/// Run
+/// \details
+/// This function runs the released task with the earliest deadline and updates its statistics. It returns
+/// true if a task has been run, or false when no task was released; the caller is free to do other work then.
+bool taskScheduler::run(){
+	const uint_fast64_t now = hwlib::now_us();
+	int selected = -1;
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		if(slots[i].enabled && slots[i].release <= now){
+			if(selected < 0 || slots[i].release + slots[i].deadline < slots[selected].release + slots[selected].deadline){
+				selected = i;
+			}
+		}
+	}
+	if(selected < 0){
+		return false;
+	}
+	auto & slot = slots[selected];
+	slot.task->run();
+	const uint_fast64_t end = hwlib::now_us();
+	slot.runs++;
+	if(now - slot.release > slot.maxLateness){
+		slot.maxLateness = now - slot.release;
+	}
+	if(end - now > slot.maxExecution){
+		slot.maxExecution = end - now;
+	}
+	if(end > slot.release + slot.deadline){
+		slot.overruns++;
+		totalOverruns++;
+	}
+	slot.release += slot.period;
+	if(slot.release + slot.period <= end){
+		const uint_fast64_t missed = (end - slot.release) / slot.period;
+		slot.skipped += missed;
+		slot.release += missed * slot.period;
+	}
+	return true;
+}
+
+/// \brief
+/// Get Ticks
+/// \details
+/// This function returns the amount of ticks that have passed since the scheduler has been constructed.
+uint_fast64_t taskScheduler::getTicks(){
+	return (hwlib::now_us() - start) / tickDuration;
+}
+
+/// \brief
+/// Ticks Until Release
+/// \details
+/// This function returns the amount of whole ticks before the next task is released; 0 when a task is released
+/// already. The caller could sleep that long.
+unsigned int taskScheduler::ticksUntilRelease(){
+	const uint_fast64_t now = hwlib::now_us();
+	uint_fast64_t first = UINT_FAST64_MAX;
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		if(slots[i].enabled && slots[i].release < first){
+			first = slots[i].release;
+		}
+	}
+	if(first <= now || first == UINT_FAST64_MAX){
+		return 0;
+	}
+	return (first - now) / tickDuration;
+}
+
+/// \brief
+/// Get Overruns
+/// \details
+/// This function returns how many times the given task has completed after its deadline.
+unsigned int taskScheduler::getOverruns(const periodicTask & task){
+	auto index = find(task);
+	if(index < 0){
+		return 0;
+	}
+	return slots[index].overruns;
+}
+
+/// \brief
+/// Get Total Overruns
+/// \details
+/// This function returns how many times a task has completed after its deadline since the last reset.
+unsigned int taskScheduler::getTotalOverruns(){
+	return totalOverruns;
+}
+
+/// \brief
+/// Reset Statistics
+/// \details
+/// This function resets the kept statistics of all tasks; their periods and releases are not changed.
+void taskScheduler::resetStatistics(){
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		slots[i].runs = 0;
+		slots[i].overruns = 0;
+		slots[i].skipped = 0;
+		slots[i].maxLateness = 0;
+		slots[i].maxExecution = 0;
+	}
+	totalOverruns = 0;
+}
+
+/// \brief
+/// Print Statistics
+/// \details
+/// This function prints the period, amount of runs, overruns and skipped releases and the maximum lateness and
+/// execution time (in microseconds) of all registered tasks to the given stream.
+void taskScheduler::printStatistics(hwlib::ostream & stream){
+	stream << hwlib::left << hwlib::setw(20) << "Task" << hwlib::setw(10) << "Period" << hwlib::setw(10) << "Runs" << hwlib::setw(10) << "Overruns"
+		<< hwlib::setw(10) << "Skipped" << hwlib::setw(12) << "Late (us)" << hwlib::setw(12) << "Exec (us)" << hwlib::endl;
+	for(unsigned int i = 0; i < amountOfTasks; i++){
+		stream << hwlib::left << hwlib::setw(20) << slots[i].name << hwlib::setw(10) << unsigned(slots[i].period / tickDuration) << hwlib::setw(10) << slots[i].runs
+			<< hwlib::setw(10) << slots[i].overruns << hwlib::setw(10) << slots[i].skipped << hwlib::setw(12) << unsigned(slots[i].maxLateness)
+			<< hwlib::setw(12) << unsigned(slots[i].maxExecution) << hwlib::endl;
+	}
+}
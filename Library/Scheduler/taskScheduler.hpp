@@ -0,0 +1,110 @@
+/// @file
+
+#ifndef __TASK_SCHEDULER_HPP
+#define __TASK_SCHEDULER_HPP
+
+/// \brief
+/// Periodic Task
+/// \details
+/// This is an abstract class for all work that has to be done periodically by a taskScheduler. The
+/// run() function is called once every period and should return as soon as possible; there is no
+/// preemption, so a task that takes long delays all other tasks.
+class periodicTask{
+	public:
+		virtual void run() = 0;
+};
+
+/// \brief
+/// Task Function
+/// \details
+/// This is a class which makes it possible to turn a lambda into a periodicTask.
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto encoderPoll = taskFunction([&](){ button.update(); });
+/// ~~~~~~~~~~~~~~~
+template<typename T>
+class taskFunction : public periodicTask {
+	private:
+		T function;
+	public:
+		taskFunction(T function):
+			function(function)
+		{}
+
+		void run() override {
+			function();
+		}
+};
+
+/// \brief
+/// Task Scheduler
+/// \details
+/// This is a cooperative, tick-based scheduler for periodic tasks. Every task has a period and a deadline,
+/// both in ticks (1ms by default). A task is released every period; the deadline is the time after its
+/// release in which it has to be completed. When multiple tasks are released, the one with the earliest
+/// deadline is run first.
+///
+/// The scheduler also monitors the timing. For every task the amount of runs, the maximum lateness (time
+/// between release and start) and the maximum execution time are kept. A run that completes after its
+/// deadline is counted as an overrun. When a task is so late that one or more complete periods have passed,
+/// those releases are skipped instead of run in a burst; they are counted as well.
+///
+///	All supported operations are:
+///		- Add Task
+///		- Enable/Disable Task
+///		- Trigger Task
+///		- Run
+///		- Get Overruns
+///		- Print Statistics
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto scheduler = taskScheduler();
+/// auto encoderPoll = taskFunction([&](){ button.update(); });
+/// auto displayRefresh = taskFunction([&](){ terminal << "\f" << button.getPos() << hwlib::flush; });
+/// scheduler.add(encoderPoll, 2, 1, "Encoder Poll");			//Every 2ms, within 1ms
+/// scheduler.add(displayRefresh, 100, 100, "Display Refresh");	//Every 100ms
+///
+/// for(;;){
+/// 	scheduler.run();
+/// }
+/// ~~~~~~~~~~~~~~~
+class taskScheduler{
+	private:
+		struct taskSlot{
+			periodicTask * task = nullptr;
+			const char * name = "";
+			uint_fast64_t period = 0;
+			uint_fast64_t deadline = 0;
+			uint_fast64_t release = 0;
+			bool enabled = true;
+			unsigned int runs = 0;
+			unsigned int overruns = 0;
+			unsigned int skipped = 0;
+			uint_fast64_t maxLateness = 0;
+			uint_fast64_t maxExecution = 0;
+		};
+		static constexpr unsigned int maxTasks = 12;
+		std::array<taskSlot, maxTasks> slots = {};
+		unsigned int amountOfTasks = 0;
+		const unsigned int tickDuration;
+		const uint_fast64_t start;
+		unsigned int totalOverruns = 0;
+		int find(const periodicTask & task);
+	public:
+		taskScheduler(const unsigned int tickDuration = 1000);
+
+		bool add(periodicTask & task, const unsigned int period, const unsigned int deadline, const char * name);
+		void enable(periodicTask & task, const bool enable = true);
+		void trigger(periodicTask & task);
+
+		bool run();
+		uint_fast64_t getTicks();
+		unsigned int ticksUntilRelease();
+
+		unsigned int getOverruns(const periodicTask & task);
+		unsigned int getTotalOverruns();
+		void resetStatistics();
+		void printStatistics(hwlib::ostream & stream);
+};
+
+#endif //__TASK_SCHEDULER_HPP
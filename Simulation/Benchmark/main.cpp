@@ -0,0 +1,119 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "RDA5807.hpp"
+#include "GUI.hpp"
+#include "DS3231.hpp"
+#include "simulatedLine.hpp"
+#include "framebuffer.hpp"
+
+/// \brief
+/// Screen State
+/// \details
+/// This struct contains all values displayMenuUpdate() is called with during a scripted session.
+struct screenState{
+	unsigned int signalStrength = 30;
+	unsigned int frequency = 1007;
+	bool change = false;
+	unsigned int voltage = 38;
+	bool stereo = false;
+	unsigned int menuArea = 1;
+	const char * stationName = "SIMULATE";
+	dateData date = dateData(1, 19, 10, 2026);
+};
+
+/// \brief
+/// Benchmark
+/// \details
+/// This program renders the GUI into an offscreen framebuffer on the host and measures the draw calls, the pixels that
+/// actually changed and the bytes an SSD1306 would have sent per displayMenuUpdate(), for a couple of scripted sessions.
+/// After every session, the screen is saved as PBM image. Since nothing depends on timing or hardware, the results
+/// are the same every run; a rendering change that makes a session more expensive shows up right away.
+int main( void ){
+  auto scl = simulatedLine();
+  auto sda = simulatedLine();
+  auto i2c_bus = hwlib::i2c_bus_bit_banged_scl_sda(scl, sda);
+  auto radio = RDA5807(i2c_bus);
+
+  auto screen = framebuffer();
+  auto display = GUI(screen);
+
+  screenState state;
+  auto update = [&](const bool force = false){
+    display.displayMenuUpdate(state.signalStrength, state.frequency, state.change, state.voltage, state.stereo, state.menuArea, radio, true, state.stationName, false, state.date, force);
+  };
+
+  hwlib::cout << hwlib::left << hwlib::setw(12) << "Session" << hwlib::setw(10) << "Updates" << hwlib::setw(10) << "Draws"
+    << hwlib::setw(10) << "Pixels" << hwlib::setw(10) << "Flushes" << hwlib::setw(10) << "Bytes" << hwlib::setw(12) << "Bytes/Upd" << hwlib::endl;
+  unsigned int idleBytes = 0;
+  auto session = [&](const char * name, const unsigned int updates, auto && step){
+    screen.resetStatistics();
+    for(unsigned int i = 0; i < updates; i++){
+      step(i);
+    }
+    auto & statistics = screen.getStatistics();
+    hwlib::cout << hwlib::left << hwlib::setw(12) << name << hwlib::setw(10) << updates << hwlib::setw(10) << statistics.drawCalls
+      << hwlib::setw(10) << statistics.touchedPixels << hwlib::setw(10) << statistics.flushes << hwlib::setw(10) << statistics.sentBytes
+      << hwlib::setw(12) << statistics.sentBytes / updates << hwlib::endl;
+    char fileName[32];
+    auto stream = textStream(fileName, sizeof(fileName));
+    stream << name << ".pbm";
+    screen.save(fileName);
+    return statistics.sentBytes;
+  };
+
+  session("Startup", 1, [&](unsigned int){ update(true); });
+  idleBytes = session("Idle", 100, [&](unsigned int){ update(); });
+  session("Signal", 100, [&](unsigned int i){
+    state.signalStrength = 24 + (i * 7) % 36;
+    state.stereo = state.signalStrength > 40;
+    update();
+  });
+  session("Battery", 100, [&](unsigned int i){
+    state.voltage = 42 - i / 10;
+    update();
+  });
+  //The frequency is drawn just above the menu; redrawing it should leave the menu row as it is.
+  bool menuRow[layout::menu::width * layout::menu::height];
+  auto compareMenuRow = [&](const bool save){
+    bool same = true;
+    for(int y = 0; y < layout::menu::height; y++){
+      for(int x = 0; x < layout::menu::width; x++){
+        const bool pixel = screen.read(layout::menu::start() + hwlib::xy(x, y));
+        same &= save || menuRow[y * layout::menu::width + x] == pixel;
+        menuRow[y * layout::menu::width + x] = pixel;
+      }
+    }
+    return same;
+  };
+  compareMenuRow(true);
+  session("Tuning", 100, [&](unsigned int i){
+    state.change = true;
+    state.frequency = 1000 + i;
+    update();
+  });
+  const bool menuRowKept = compareMenuRow(false);
+  session("Menu", 80, [&](unsigned int i){
+    state.change = false;
+    state.menuArea = (i / 10) % 8;
+    update();
+  });
+  session("Station", 8, [&](unsigned int i){
+    static const char * const names[] = {"RADIO 1", "RADIO 2", "3FM", "SKYRADIO"};
+    state.stationName = names[i % 4];
+    update();
+  });
+
+  char radioText[64] = {"Portable Radio Benchmark; a RadioText that is too long to fit  "};
+  display.setRadioText(radioText);
+  session("RadioText", 100, [&](unsigned int i){
+    if(i == 0){
+      state.stationName = "SIMULATE";
+      update();
+    }
+    display.scrollStationText();
+  });
+
+  hwlib::cout << hwlib::endl << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "Nothing is drawn or sent when nothing changes: " << (idleBytes == 0) << hwlib::endl;
+  hwlib::cout << hwlib::setw(100) << hwlib::left << "Menu row is kept when the frequency changes: " << menuRowKept << hwlib::endl;
+}
@@ -0,0 +1,138 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "RDA5807.hpp"
+#include "GUI.hpp"
+#include "DS3231.hpp"
+#include "A24C256.hpp"
+#include "SSD1306.hpp"
+#include "busScheduler.hpp"
+#include "bootSequence.hpp"
+#include "keyValueStore.hpp"
+#include "presetStore.hpp"
+#include "resumeState.hpp"
+#include "radioDataCache.hpp"
+#include "simulatedLine.hpp"
+
+/// \brief
+/// Boot
+/// \details
+/// This function starts the same drivers with the same stages as the application does; either one after another
+/// (serialized) or interleaved (overlapped). The timeline of the boot is printed and the moment the first frame has
+/// been completed is returned (in milliseconds).
+unsigned int boot(const bool overlapped){
+  auto boot = bootSequence();
+  auto scl = simulatedLine();
+  auto sda = simulatedLine();
+  auto i2c_bus = hwlib::i2c_bus_bit_banged_scl_sda(scl, sda);
+
+  auto memory = A24C256(i2c_bus);
+  auto settings = keyValueStore(memory, 4096, 1024);
+  auto resume = resumeState(settings);
+  resumeRecord state;
+  auto presets = presetStore(memory);
+  auto stations = radioDataCache(memory, 8192);
+  stationInfo cachedStation;
+  const char * stationName = nullptr;
+  auto radio = RDA5807(i2c_bus);
+  auto clock = DS3231(i2c_bus);
+  auto oled = SSD1306(i2c_bus);
+  auto bus = busScheduler();
+  bus.add(oled, busPriority::display, "Display Flush");
+  oled.attach(bus);
+  auto display = GUI(oled);
+  timeData time;
+  dateData date;
+
+  auto settingsLoad = bootFunction([&](){
+    settings.mount();
+    resume.load(state);
+    return true;
+  });
+  auto presetLoad = bootFunction([&](){
+    if(!presets.load()){
+      presets.format();
+      presets.add(preset(100.7, "SIMULATE"));
+    }
+    stationName = presets.get(0).name;
+    return true;
+  });
+  auto stationLoad = bootFunction([&](){
+    stations.load();
+    if(stations.find(state.frequency * 1000 + 0.5, cachedStation)){
+      stationName = cachedStation.name;
+    }
+    return true;
+  });
+  auto clockLoad = bootFunction([&](){
+    time = clock.getTime();
+    date = clock.getDate();
+    return true;
+  });
+  bool frameRequested = false;
+  auto firstFrame = bootFunction([&](){
+    if(!frameRequested){
+      frameRequested = true;
+      display.displayMenuUpdate(30, state.frequency * 10, false, 38, false, 1, radio, true, stationName, state.muted, date, true);
+    }
+    bus.run();
+    return !oled.flushPending();
+  });
+  unsigned int radioStep = 0;
+  auto radioStart = bootFunction([&](){
+    switch(radioStep++){
+      case 0:
+        radio.begin(state.muted, 0);
+        return false;
+      case 1:
+        radio.setVolume(state.volume);
+        radio.setBassBoost(state.bassBoost);
+        return false;
+      default:
+        radio.setFrequency(state.frequency);
+        return true;
+    }
+  });
+
+  if(overlapped){
+    boot.add(settingsLoad, "Settings");
+    boot.add(radioStart, "Radio", &settingsLoad, 1000);
+    boot.add(presetLoad, "Presets", &settingsLoad);
+    boot.add(stationLoad, "Stations", &presetLoad);
+    boot.add(clockLoad, "Clock", &stationLoad);
+    boot.add(firstFrame, "First Frame", &clockLoad);
+  } else {
+    boot.add(settingsLoad, "Settings");
+    boot.add(radioStart, "Radio", &settingsLoad, 1000);
+    boot.add(presetLoad, "Presets", &radioStart);
+    boot.add(stationLoad, "Stations", &presetLoad);
+    boot.add(clockLoad, "Clock", &stationLoad);
+    boot.add(firstFrame, "First Frame", &clockLoad);
+  }
+  unsigned int frameDone = 0;
+  while(!boot.run()){
+    if(frameDone == 0 && boot.isDone(firstFrame)){
+      frameDone = boot.getDuration();
+    }
+  }
+  if(frameDone == 0){
+    frameDone = boot.getDuration();
+  }
+  boot.printTimeline(hwlib::cout);
+  hwlib::cout << "First frame after " << frameDone << "ms" << hwlib::endl << hwlib::endl;
+  return frameDone;
+}
+
+/// \brief
+/// Boot Simulation
+/// \details
+/// This program boots the radio twice on the host; first with all stages one after another, like the application used
+/// to, then interleaved with the bootSequence. Both timelines are printed. Nothing answers on the simulated bus, so the
+/// memory is empty, the writes to it time out and all reads return 0xFF; the timing of the drivers is real.
+int main( void ){
+  hwlib::cout << "Serialized" << hwlib::endl;
+  const unsigned int serialized = boot(false);
+  hwlib::cout << "Overlapped" << hwlib::endl;
+  const unsigned int overlapped = boot(true);
+  hwlib::cout << hwlib::boolalpha << hwlib::setw(100) << hwlib::left << "First frame is shown earlier when the stages overlap: " << (overlapped < serialized) << hwlib::endl;
+}
@@ -0,0 +1,138 @@
+/// @file
+
+#include <cstdio>
+#include "hwlib.hpp"
+#include "framebuffer.hpp"
+
+/// \brief
+/// Constructor
+/// \details
+/// This constructor has no parameters. The framebuffer is 128x64 pixels, white on black; just like the SSD1306.
+framebuffer::framebuffer():
+	window(hwlib::xy(width, pages * 8), hwlib::white, hwlib::black)
+{}
+
+/// \brief
+/// Mark Dirty
+/// \details
+/// This function extends the dirty range of the given page with the given column.
+void framebuffer::markDirty(const unsigned int page, const unsigned int column){
+	if(dirtyStart[page] >= dirtyEnd[page]){
+		dirtyStart[page] = column;
+		dirtyEnd[page] = column + 1;
+	} else if(column < dirtyStart[page]){
+		dirtyStart[page] = column;
+	} else if(column >= dirtyEnd[page]){
+		dirtyEnd[page] = column + 1;
+	}
+}
+
+/// \brief
+/// Write Pixel
+/// \details
+/// This function sets or clears the given pixel. Every call is counted as draw call; only when the pixel actually
+/// changes, it is counted as touched pixel and its column is marked dirty.
+void framebuffer::write_implementation(hwlib::xy pos, hwlib::color col){
+	const unsigned int page = pos.y / 8;
+	const unsigned int index = pos.x + page * width;
+	uint8_t value = buffer[index];
+	if(col == foreground){
+		value |= (1 << (pos.y % 8));
+	} else {
+		value &= ~(1 << (pos.y % 8));
+	}
+	statistics.drawCalls++;
+	if(value != buffer[index]){
+		buffer[index] = value;
+		statistics.touchedPixels++;
+		markDirty(page, pos.x);
+	}
+}
+
+/// \brief
+/// Clear
+/// \details
+/// This function fills the complete buffer with the given color. Every changed pixel is counted as touched pixel;
+/// the clear itself as one draw call.
+void framebuffer::clear(hwlib::color col){
+	const uint8_t value = (col == foreground) ? 0xFF : 0x00;
+	statistics.drawCalls++;
+	for(unsigned int page = 0; page < pages; page++){
+		for(unsigned int column = 0; column < width; column++){
+			uint8_t difference = buffer[page * width + column] ^ value;
+			if(difference != 0){
+				buffer[page * width + column] = value;
+				markDirty(page, column);
+				for(; difference != 0; difference &= difference - 1){
+					statistics.touchedPixels++;
+				}
+			}
+		}
+	}
+}
+
+/// \brief
+/// Flush
+/// \details
+/// This function counts the bytes an SSD1306 would send for this flush; the dirty columns of every page. Afterwards,
+/// the buffer is clean again.
+void framebuffer::flush(){
+	statistics.flushes++;
+	for(unsigned int page = 0; page < pages; page++){
+		if(dirtyStart[page] < dirtyEnd[page]){
+			statistics.sentBytes += dirtyEnd[page] - dirtyStart[page];
+		}
+		dirtyStart[page] = 0;
+		dirtyEnd[page] = 0;
+	}
+}
+
+/// \brief
+/// Read Pixel
+/// \details
+/// This function returns true if the pixel at the given position is in the foreground color.
+bool framebuffer::read(const hwlib::xy & pos){
+	if(pos.x < 0 || pos.y < 0 || pos.x >= int(width) || pos.y >= int(pages * 8)){
+		return false;
+	}
+	return (buffer[pos.x + (pos.y / 8) * width] >> (pos.y % 8)) & 1;
+}
+
+/// \brief
+/// Get Statistics
+/// \details
+/// This function returns the statistics since construction or the last reset.
+const framebufferStatistics & framebuffer::getStatistics(){
+	return statistics;
+}
+
+/// \brief
+/// Reset Statistics
+/// \details
+/// This function sets all statistics to 0. The content of the buffer is kept.
+void framebuffer::resetStatistics(){
+	statistics = framebufferStatistics();
+}
+
+/// \brief
+/// Save As PBM
+/// \details
+/// This function writes the content of the buffer to the file with the given name as binary PBM (P4); a foreground
+/// pixel is black, just like ink. Returns false if the file couldn't be written.
+bool framebuffer::save(const char * fileName){
+	auto file = std::fopen(fileName, "wb");
+	if(file == nullptr){
+		return false;
+	}
+	std::fprintf(file, "P4\n%u %u\n", width, pages * 8);
+	for(unsigned int y = 0; y < pages * 8; y++){
+		for(unsigned int x = 0; x < width; x += 8){
+			uint8_t row = 0;
+			for(unsigned int bit = 0; bit < 8; bit++){
+				row = (row << 1) | read(hwlib::xy(x + bit, y));
+			}
+			std::fputc(row, file);
+		}
+	}
+	return std::fclose(file) == 0;
+}
@@ -0,0 +1,73 @@
+/// @file
+
+#ifndef __FRAMEBUFFER_HPP
+#define __FRAMEBUFFER_HPP
+
+/// \brief
+/// Framebuffer Statistics
+/// \details
+/// This struct contains the amount of rendering work done on a framebuffer; the amount of draw calls (pixel
+/// writes), the amount of pixels that actually changed, the amount of flushes and the amount of bytes an
+/// SSD1306 would have sent for those flushes.
+///
+/// Used by framebuffer.
+struct framebufferStatistics{
+	unsigned int drawCalls = 0;
+	unsigned int touchedPixels = 0;
+	unsigned int flushes = 0;
+	unsigned int sentBytes = 0;
+};
+
+/// \brief
+/// Offscreen Framebuffer
+/// \details
+/// This is a 128x64 monochrome hwlib::window that only exists in RAM; everything the GUI draws on the OLED can
+/// be drawn on it instead, on the host. The buffer is organized exactly like the one of the SSD1306 (8 pages of
+/// 128 columns), and the changed columns per page are tracked the same way. This way the bytes that would have been
+/// sent to the display are counted, next to the draw calls and the pixels that actually changed.
+///
+/// The content can be saved as PBM (portable bitmap) image to compare renderings or to look at them.
+///
+///	All supported operations are:
+///		- Draw (through hwlib::window)
+///		- Clear
+///		- Flush (counts the bytes that would have been sent)
+///		- Read Pixel
+///		- Get/Reset Statistics
+///		- Save as PBM
+///
+/// ~~~~~~~~~~~~~~~{.cpp}
+/// auto screen = framebuffer();
+/// auto font = hwlib::font_default_8x8();
+/// auto terminal = hwlib::terminal_from(screen, font);
+///
+/// terminal << "\f" << "Hello World!" << hwlib::flush;
+/// hwlib::cout << screen.getStatistics().sentBytes << hwlib::endl;
+/// screen.save("hello.pbm");
+/// ~~~~~~~~~~~~~~~
+class framebuffer : public hwlib::window {
+	private:
+		static constexpr unsigned int width = 128;
+		static constexpr unsigned int pages = 8;
+		uint8_t buffer[width * pages] = {};
+		uint8_t dirtyStart[pages] = {};
+		uint8_t dirtyEnd[pages] = {};
+		framebufferStatistics statistics;
+
+		void markDirty(const unsigned int page, const unsigned int column);
+	protected:
+		void write_implementation(hwlib::xy pos, hwlib::color col) override;
+	public:
+		framebuffer();
+
+		void clear(hwlib::color col) override;
+		using hwlib::window::clear;
+		void flush() override;
+
+		bool read(const hwlib::xy & pos);
+		const framebufferStatistics & getStatistics();
+		void resetStatistics();
+		bool save(const char * fileName);
+};
+
+#endif //__FRAMEBUFFER_HPP
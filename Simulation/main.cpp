@@ -0,0 +1,94 @@
+/// @file
+
+#include "hwlib.hpp"
+#include "RDA5807.hpp"
+#include "GUI.hpp"
+#include "KY040.hpp"
+#include "A24C256.hpp"
+#include "DS3231.hpp"
+#include "SSD1306.hpp"
+#include "busScheduler.hpp"
+#include "busTracer.hpp"
+#include "simulatedLine.hpp"
+
+/// \brief
+/// Simulation
+/// \details
+/// This program performs a scripted session of the Portable Radio on the host: starting up, tuning, a couple of
+/// display refreshes and preset reads. Afterwards, the statistics of all I2C traffic are printed.
+int main( void ){
+  auto scl = simulatedLine();
+  auto sda = simulatedLine();
+  auto i2c_bus = busTracer(scl, sda);
+  i2c_bus.addDriver("RDA5807", 0x10);
+  i2c_bus.addDriver("RDA5807", 0x11);
+  i2c_bus.addDriver("SSD1306", 0x3C);
+  i2c_bus.addDriver("A24C256", 0x50);
+  i2c_bus.addDriver("DS3231", 0x68);
+
+  auto radio = RDA5807(i2c_bus);
+  {
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "begin");
+    radio.begin();
+  }
+  auto oled = SSD1306(i2c_bus);
+  auto memory = A24C256(i2c_bus);
+  auto clock = DS3231(i2c_bus);
+
+  auto display = GUI(oled);
+
+  auto bus = busScheduler();
+  unsigned int signalStrength = 0;
+  bool stereo = false;
+  float frequency = 0;
+  dateData date;
+  auto radioDataCapture = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "radioDataSystem", "radioDataCapture");
+    radio.radioData.update();
+    return true;
+  });
+  auto signalSample = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "signalSample");
+    signalStrength = radio.signalStrength();
+    stereo = radio.stereoReception();
+    frequency = radio.getFrequency();
+    return true;
+  });
+  auto clockRead = busFunction([&](){
+    auto scope = busTraceScope(i2c_bus, "DS3231", "clockRead");
+    clock.getTime();
+    date = clock.getDate();
+    return true;
+  });
+  bus.add(radioDataCapture, busPriority::radioData, "RDS Capture");
+  bus.add(signalSample, busPriority::signal, "RSSI Sample");
+  bus.add(clockRead, busPriority::clock, "Clock Read");
+  bus.add(oled, busPriority::display, "Display Flush");
+  oled.attach(bus);
+
+  {
+    auto scope = busTraceScope(i2c_bus, "RDA5807", "presetTune");
+    radio.setFrequency(100.7);
+  }
+
+  char stationName[] = {"SIMULATE"};
+  for(unsigned int i = 0; i < 20; i++){
+    bus.request(radioDataCapture);
+    bus.request(signalSample);
+    bus.request(clockRead);
+    while(bus.isPending(signalSample) || bus.isPending(clockRead)){
+      bus.run();
+    }
+    display.displayMenuUpdate(signalStrength, frequency * 10, i % 2, 38, stereo, i % 8, radio, true, stationName, false, date);
+    if(i % 5 == 0){
+      auto scope = busTraceScope(i2c_bus, "A24C256", "presetName");
+      uint8_t name[8];
+      memory.read(i * 10 + 3, 8, name);
+    }
+    bus.runAll();
+  }
+
+  i2c_bus.printStatistics(hwlib::cout);
+  hwlib::cout << hwlib::endl;
+  bus.printStatistics(hwlib::cout);
+}
@@ -0,0 +1,24 @@
+/// @file
+
+#ifndef __SIMULATED_LINE_HPP
+#define __SIMULATED_LINE_HPP
+
+/// \brief
+/// Simulated Line
+/// \details
+/// This is an open-collector line without anything connected to it. It reads back what has been written
+/// to it, so a released line reads high; just like a line with a pull-up resistor.
+class simulatedLine : public hwlib::pin_oc {
+	private:
+		bool level = true;
+	public:
+		void write(bool x) override {
+			level = x;
+		}
+
+		bool read() override {
+			return level;
+		}
+};
+
+#endif //__SIMULATED_LINE_HPP